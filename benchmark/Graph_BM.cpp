@@ -48,6 +48,58 @@ static void AddEdgeX(benchmark::State &state)
 }
 BENCHMARK(AddEdgeX)->RangeMultiplier(16)->Range((unsigned long)1, (unsigned long)1 << 16);
 
+static void AddEdgesX(benchmark::State &state)
+{
+    std::vector<const CXXGRAPH::Edge<int> *> edgesX;
+    for (auto it = edges.begin(); it != edges.find(state.range(0)); ++it)
+    {
+        edgesX.push_back(it->second);
+    }
+    for (auto _ : state)
+    {
+        CXXGRAPH::Graph<int> g;
+        g.addEdges(edgesX);
+    }
+}
+BENCHMARK(AddEdgesX)->RangeMultiplier(16)->Range((unsigned long)1, (unsigned long)1 << 16);
+
+static void MoveGraphX_TS(benchmark::State &state)
+{
+    std::vector<const CXXGRAPH::Edge<int> *> edgesX;
+    for (auto it = edges.begin(); it != edges.find(state.range(0)); ++it)
+    {
+        edgesX.push_back(it->second);
+    }
+    CXXGRAPH::Graph<int> g;
+    g.addEdges(edgesX);
+    for (auto _ : state)
+    {
+        // hand the Graph over and back, without copying the Edge Set
+        CXXGRAPH::Graph_TS<int> g_ts(std::move(g));
+        g = std::move(static_cast<CXXGRAPH::Graph<int> &>(g_ts));
+    }
+}
+BENCHMARK(MoveGraphX_TS)->RangeMultiplier(16)->Range((unsigned long)1, (unsigned long)1 << 16);
+
+static void HasEdgeX(benchmark::State &state)
+{
+    std::vector<const CXXGRAPH::Edge<int> *> edgesX;
+    for (auto it = edges.begin(); it != edges.find(state.range(0)); ++it)
+    {
+        edgesX.push_back(it->second);
+    }
+    CXXGRAPH::Graph<int> g;
+    g.addEdges(edgesX);
+    for (auto _ : state)
+    {
+        for (auto edge : edgesX)
+        {
+            benchmark::DoNotOptimize(g.hasEdge(*edge->getNodePair().first, *edge->getNodePair().second));
+        }
+    }
+}
+BENCHMARK(HasEdgeX)->RangeMultiplier(16)->Range((unsigned long)1, (unsigned long)1 << 16);
+
 static void GraphCreation_TS(benchmark::State &state)
 {
     for (auto _ : state)
@@ -88,6 +140,21 @@ static void AddEdgeX_TS(benchmark::State &state)
 }
 BENCHMARK(AddEdgeX_TS)->RangeMultiplier(16)->Range((unsigned long)1, (unsigned long)1 << 16);
 
+static void AddEdgesX_TS(benchmark::State &state)
+{
+    std::vector<const CXXGRAPH::Edge<int> *> edgesX;
+    for (auto it = edges.begin(); it != edges.find(state.range(0)); ++it)
+    {
+        edgesX.push_back(it->second);
+    }
+    for (auto _ : state)
+    {
+        CXXGRAPH::Graph_TS<int> g;
+        g.addEdges(edgesX);
+    }
+}
+BENCHMARK(AddEdgesX_TS)->RangeMultiplier(16)->Range((unsigned long)1, (unsigned long)1 << 16);
+
 static void BM_AddEdgeX_MT_TS(benchmark::State &state)
 {
     if (state.thread_index() == 0)
@@ -0,0 +1,167 @@
+#include <benchmark/benchmark.h>
+#include "CXXGraph.hpp"
+#include "Utilities.hpp"
+
+static const unsigned long GRID_SIDE = 256;
+static auto gridNodes = generateRandomNodes(GRID_SIDE * GRID_SIDE, 2);
+static auto gridEdges = generateGridEdges(GRID_SIDE, GRID_SIDE, gridNodes);
+
+static const CXXGRAPH::Graph<int> &gridGraph()
+{
+    static CXXGRAPH::Graph<int> g = []()
+    {
+        CXXGRAPH::Graph<int> grid;
+        std::vector<const CXXGRAPH::Edge<int> *> edgesX;
+        for (auto &edge : gridEdges)
+        {
+            edgesX.push_back(edge.second);
+        }
+        grid.addEdges(edgesX);
+        return grid;
+    }();
+    return g;
+}
+
+static std::vector<const CXXGRAPH::Node<int> *> gridSample(unsigned long count, unsigned long seed)
+{
+    std::vector<const CXXGRAPH::Node<int> *> sample;
+    for (unsigned long i = 0; i < count; i++)
+    {
+        sample.push_back(gridNodes.at((seed + i * 7919) % gridNodes.size()));
+    }
+    return sample;
+}
+
+static void DijkstraLoop(benchmark::State &state)
+{
+    const auto &g = gridGraph();
+    auto sources = gridSample(state.range(0), 1);
+    auto targets = gridSample(16, 2);
+    for (auto _ : state)
+    {
+        for (auto source : sources)
+        {
+            for (auto target : targets)
+            {
+                benchmark::DoNotOptimize(g.dijkstra(*source, *target));
+            }
+        }
+    }
+}
+BENCHMARK(DijkstraLoop)->RangeMultiplier(4)->Range((unsigned long)1, (unsigned long)1 << 4);
+
+static void DijkstraBatch(benchmark::State &state)
+{
+    const auto &g = gridGraph();
+    auto sources = gridSample(state.range(0), 1);
+    auto targets = gridSample(16, 2);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(g.dijkstraBatch(sources, targets));
+    }
+}
+BENCHMARK(DijkstraBatch)->RangeMultiplier(4)->Range((unsigned long)1, (unsigned long)1 << 4);
+
+// pairs of grid nodes a diagonal offset apart, the distance of a point to point query grows with it
+static std::vector<std::pair<const CXXGRAPH::Node<int> *, const CXXGRAPH::Node<int> *>> gridPairs(unsigned long offset)
+{
+    std::vector<std::pair<const CXXGRAPH::Node<int> *, const CXXGRAPH::Node<int> *>> pairs;
+    unsigned long span = GRID_SIDE - offset;
+    for (unsigned long i = 0; i < 8; i++)
+    {
+        unsigned long x = (i * 37) % span;
+        unsigned long y = (i * 91) % span;
+        pairs.emplace_back(gridNodes.at(y * GRID_SIDE + x), gridNodes.at((y + offset) * GRID_SIDE + x + offset));
+    }
+    return pairs;
+}
+
+static void DijkstraPointToPoint(benchmark::State &state)
+{
+    const auto &g = gridGraph();
+    auto pairs = gridPairs(state.range(0));
+    for (auto _ : state)
+    {
+        for (auto &pair : pairs)
+        {
+            benchmark::DoNotOptimize(g.dijkstra(*pair.first, *pair.second));
+        }
+    }
+}
+BENCHMARK(DijkstraPointToPoint)->RangeMultiplier(4)->Range((unsigned long)4, (unsigned long)1 << 7);
+
+static void BidirectionalDijkstraPointToPoint(benchmark::State &state)
+{
+    const auto &g = gridGraph();
+    auto pairs = gridPairs(state.range(0));
+    for (auto _ : state)
+    {
+        for (auto &pair : pairs)
+        {
+            benchmark::DoNotOptimize(g.bidirectionalDijkstra(*pair.first, *pair.second));
+        }
+    }
+}
+BENCHMARK(BidirectionalDijkstraPointToPoint)->RangeMultiplier(4)->Range((unsigned long)4, (unsigned long)1 << 7);
+
+static void AStarPointToPoint(benchmark::State &state)
+{
+    const auto &g = gridGraph();
+    auto pairs = gridPairs(state.range(0));
+    for (auto _ : state)
+    {
+        for (auto &pair : pairs)
+        {
+            // the weights are at least 1, the manhattan distance on the grid is admissible
+            auto targetId = pair.second->getId();
+            benchmark::DoNotOptimize(g.astar(*pair.first, *pair.second, [targetId](const CXXGRAPH::Node<int> &node)
+                                             {
+                                                 double dx = std::abs(long(node.getId() % GRID_SIDE) - long(targetId % GRID_SIDE));
+                                                 double dy = std::abs(long(node.getId() / GRID_SIDE) - long(targetId / GRID_SIDE));
+                                                 return dx + dy; }));
+        }
+    }
+}
+BENCHMARK(AStarPointToPoint)->RangeMultiplier(4)->Range((unsigned long)4, (unsigned long)1 << 7);
+
+static void DijkstraAllSSSP(benchmark::State &state)
+{
+    const auto &g = gridGraph();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(g.dijkstraAll(*gridNodes.at(0)));
+    }
+}
+BENCHMARK(DijkstraAllSSSP);
+
+static void DeltaSteppingSSSP(benchmark::State &state)
+{
+    const auto &g = gridGraph();
+    for (auto _ : state)
+    {
+        // the grid weights are 1..10, delta is close to their average
+        benchmark::DoNotOptimize(g.deltaStepping(*gridNodes.at(0), 5, state.range(0)));
+    }
+}
+BENCHMARK(DeltaSteppingSSSP)->RangeMultiplier(2)->Range(1, 8);
+
+static void DialSSSP(benchmark::State &state)
+{
+    const auto &g = gridGraph();
+    for (auto _ : state)
+    {
+        // the grid weights are 1..10, a looser bound gives more buckets to go around
+        benchmark::DoNotOptimize(g.dial(*gridNodes.at(0), state.range(0)));
+    }
+}
+BENCHMARK(DialSSSP)->Arg(10)->Arg(1 << 10)->Arg(1 << 16);
+
+static void RadixDijkstraSSSP(benchmark::State &state)
+{
+    const auto &g = gridGraph();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(g.radixDijkstra(*gridNodes.at(0)));
+    }
+}
+BENCHMARK(RadixDijkstraSSSP);
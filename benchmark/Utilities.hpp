@@ -35,4 +35,28 @@ static std::map<unsigned long, CXXGRAPH::Edge<int> *> generateRandomEdges(unsign
     return edges;
 }
 
+static std::map<unsigned long, CXXGRAPH::Edge<int> *> generateGridEdges(unsigned long width, unsigned long height, std::map<unsigned long, CXXGRAPH::Node<int> *> nodes)
+{
+    // node ( x, y ) is nodes[y * width + x], linked to its right and lower neighbors
+    std::map<unsigned long, CXXGRAPH::Edge<int> *> edges;
+    srand((unsigned)time(NULL));
+    unsigned long index = 0;
+    for (unsigned long y = 0; y < height; y++)
+    {
+        for (unsigned long x = 0; x < width; x++)
+        {
+            if (x + 1 < width)
+            {
+                edges[index] = new CXXGRAPH::UndirectedWeightedEdge<int>(index, *(nodes.at(y * width + x)), *(nodes.at(y * width + x + 1)), (rand() % 10) + 1);
+                index++;
+            }
+            if (y + 1 < height)
+            {
+                edges[index] = new CXXGRAPH::UndirectedWeightedEdge<int>(index, *(nodes.at(y * width + x)), *(nodes.at((y + 1) * width + x)), (rand() % 10) + 1);
+                index++;
+            }
+        }
+    }
+    return edges;
+}
 #endif // __UTILITIES_H__
\ No newline at end of file
@@ -8,6 +8,10 @@
 #include "Edge/UndirectedEdge.hpp"
 #include "Edge/UndirectedWeightedEdge.hpp"
 #include "Edge/Weighted.hpp"
+#include "Graph/NodeIndex.hpp"
+#include "Graph/CompactGraph.hpp"
+#include "Graph/CompressedGraph.hpp"
+#include "Graph/EdgeColumns.hpp"
 #include "Graph/Graph.hpp"
 #include "Graph/Graph_TS.hpp"
 #include "Node/Node.hpp"
@@ -22,5 +26,10 @@
 #include "Partitioning/PartitionState.hpp"
 #include "Partitioning/PartitionStrategy.hpp"
 #include "Partitioning/Record.hpp"
+#include "Utility/Arena.hpp"
+#include "Utility/Barrier.hpp"
+#include "Utility/IndexedHeap.hpp"
+#include "Utility/MemoryUsage.hpp"
+#include "Utility/RadixHeap.hpp"
 
 #endif // __CXXGRAPH_H__
\ No newline at end of file
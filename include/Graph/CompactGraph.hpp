@@ -0,0 +1,490 @@
+/***********************************************************/
+/***      ______  ____  ______                 _         ***/
+/***     / ___\ \/ /\ \/ / ___|_ __ __ _ _ __ | |__	     ***/
+/***    | |    \  /  \  / |  _| '__/ _` | '_ \| '_ \	 ***/
+/***    | |___ /  \  /  \ |_| | | | (_| | |_) | | | |    ***/
+/***     \____/_/\_\/_/\_\____|_|  \__,_| .__/|_| |_|    ***/
+/***                                    |_|			     ***/
+/***********************************************************/
+/***     Header-Only C++ Library for Graph			     ***/
+/***	 Representation and Algorithms				     ***/
+/***********************************************************/
+/***     Author: ZigRazor			     			     ***/
+/***	 E-Mail: zigrazor@gmail.com 				     ***/
+/***********************************************************/
+/***	 Collaboration: ----------- 				     ***/
+/***********************************************************/
+/***	 License: AGPL v3.0							     ***/
+/***********************************************************/
+
+#ifndef __COMPACTGRAPH_H__
+#define __COMPACTGRAPH_H__
+
+#pragma once
+
+#include <list>
+#include <memory>
+#include <iterator>
+#include <vector>
+#include <optional>
+#include <cstdint>
+#include <mutex>
+#include <atomic>
+
+#include "Node/Node.hpp"
+#include "Edge/Edge.hpp"
+#include "Edge/Weighted.hpp"
+#include "Graph/NodeIndex.hpp"
+
+namespace CXXGRAPH
+{
+	/// Plain record of a link of the CompactGraph. The algorithms read it directly,
+	/// without virtual calls or dynamic_cast on the Edge that generated the link.
+	/// The Weight type is the one of the GraphPolicy, a float weight shrinks the record to 16 bytes.
+	template <typename Weight>
+	struct BasicEdgeRecord
+	{
+		static constexpr std::uint8_t DIRECTED = 0x1; ///< The link comes from a Directed Edge
+		static constexpr std::uint8_t WEIGHTED = 0x2; ///< The link comes from a Weighted Edge
+
+		DenseIndex from;	 ///< Dense index of the source Node
+		DenseIndex to;		 ///< Dense index of the destination Node
+		Weight weight;		 ///< Weight of the link ( 0 for not Weighted Edge )
+		std::uint8_t flags; ///< Combination of DIRECTED and WEIGHTED
+
+		bool isDirected() const { return flags & DIRECTED; }
+		bool isWeighted() const { return flags & WEIGHTED; }
+	};
+
+	using EdgeRecord = BasicEdgeRecord<double>;
+
+	/// Class that implement an immutable Compressed Sparse Row (CSR) snapshot of a Graph.
+	/// Nodes are renumbered with dense indices 0..V-1 and the outgoing links of node i
+	/// are stored in the range [offsets[i], offsets[i+1]) of the record and edge arrays.
+	/// An Undirected Edge produce two links, one for each direction.
+	/// The reverse index ( the incoming links of every node ) is built on first use.
+	template <typename T, typename Weight = double>
+	class CompactGraph
+	{
+	public:
+		using Record = BasicEdgeRecord<Weight>;
+
+	private:
+		NodeIndex<T> nodeIndex;
+		std::vector<std::size_t> offsets;
+		std::vector<Record> records;
+		std::vector<const Edge<T> *> edges;
+		// incoming links of node i are reverseLinks[reverseOffsets[i]..reverseOffsets[i+1]),
+		// as positions in the record array. Built once, also by concurrent readers
+		mutable std::once_flag reverseFlag;
+		mutable std::vector<std::size_t> reverseOffsets;
+		mutable std::vector<std::size_t> reverseLinks;
+		mutable std::atomic<bool> reverseBuilt{false};
+		void buildReverseIndex() const;
+
+	public:
+		CompactGraph() = default;
+		CompactGraph(const std::list<const Edge<T> *> &edgeSet);
+		CompactGraph(const CompactGraph<T, Weight> &compactGraph) = delete;
+		CompactGraph<T, Weight> &operator=(const CompactGraph<T, Weight> &compactGraph) = delete;
+		~CompactGraph() = default;
+		/**
+		* \brief
+		* Function that return the record of the link generated by an Edge from a Node to another
+		*
+		* @param from The dense index of the source Node
+		* @param to The dense index of the destination Node
+		* @param edge The Edge, Directed or Undirected
+		* @returns the record of the link
+		*/
+		static Record makeRecord(DenseIndex from, DenseIndex to, const Edge<T> *edge);
+		/**
+		* \brief
+		* Function that return the number of Nodes of the snapshot
+		*
+		* @returns the number of Nodes
+		*/
+		std::size_t getNumberOfNodes() const;
+		/**
+		* \brief
+		* Function that return the number of links of the snapshot
+		* ( an Undirected Edge is counted twice )
+		*
+		* @returns the number of links
+		*/
+		std::size_t getNumberOfLinks() const;
+		/**
+		* \brief
+		* Function that return the dense index of a Node
+		*
+		* @param node The Node to search
+		* @returns the index of the Node if it is inside the snapshot
+		*/
+		const std::optional<DenseIndex> getIndex(const Node<T> &node) const;
+		/**
+		* \brief
+		* Function that return the Node with a specific dense index
+		*
+		* @param index The dense index of the Node
+		* @returns the Node
+		*/
+		const Node<T> *getNode(DenseIndex index) const;
+		/**
+		* \brief
+		* Function that return the number of outgoing links of a Node
+		*
+		* @param index The dense index of the Node
+		* @returns the out degree of the Node
+		*/
+		std::size_t getOutDegree(DenseIndex index) const;
+		/**
+		* \brief
+		* Function that return the offsets array, of size V+1
+		*
+		* @returns the offsets array
+		*/
+		const std::vector<std::size_t> &getOffsets() const;
+		/**
+		* \brief
+		* Function that return the record array, parallel to the edge array
+		*
+		* @returns the record array
+		*/
+		const std::vector<Record> &getRecords() const;
+		/**
+		* \brief
+		* Function that return the array of the Edges that generate each link
+		*
+		* @returns the edge array
+		*/
+		const std::vector<const Edge<T> *> &getEdges() const;
+		/**
+		* \brief
+		* Function that return the mapping between the Nodes and their dense indices
+		*
+		* @returns the Node Index of the snapshot
+		*/
+		const NodeIndex<T> &getNodeIndex() const;
+		/**
+		* \brief
+		* Function that return an estimate of the memory used by the snapshot
+		*
+		* @returns the number of bytes
+		*/
+		std::size_t memoryUsage() const;
+		/**
+		* \brief
+		* Function that visit the outgoing links of a Node, in order of the Edge Set
+		*
+		* @param index The dense index of the Node
+		* @param function The function called with the EdgeRecord of every link
+		*/
+		template <typename Function>
+		void forEachLink(DenseIndex index, Function &&function) const;
+		/**
+		* \brief
+		* Function that return the number of incoming links of a Node
+		*
+		* @param index The dense index of the Node
+		* @returns the in degree of the Node
+		*/
+		std::size_t getInDegree(DenseIndex index) const;
+		/**
+		* \brief
+		* Function that return the reverse offsets array, of size V+1
+		*
+		* @returns the reverse offsets array
+		*/
+		const std::vector<std::size_t> &getReverseOffsets() const;
+		/**
+		* \brief
+		* Function that return the positions in the record array of the incoming links,
+		* grouped by destination Node
+		*
+		* @returns the reverse link array
+		*/
+		const std::vector<std::size_t> &getReverseLinks() const;
+		/**
+		* \brief
+		* Function that visit the incoming links of a Node, in order of the Edge Set.
+		* The source of every link is a predecessor of the Node
+		*
+		* @param index The dense index of the Node
+		* @param function The function called with the position and the EdgeRecord of every link
+		*/
+		template <typename Function>
+		void forEachInLink(DenseIndex index, Function &&function) const;
+	};
+
+	/// Element of the neighbor iteration: the Node reached by a link, the Edge that generate it and its weight.
+	/// Only pointers are handed out, the Node and the Edge are never copied.
+	template <typename T, typename Weight = double>
+	struct Neighbor
+	{
+		const Node<T> *node; ///< The Node at the other end of the link
+		const Edge<T> *edge; ///< The Edge that generate the link
+		Weight weight;		 ///< Weight of the link ( 0 for not Weighted Edge )
+	};
+
+	/// Range over the outgoing links of a Node of a CompactGraph. The range keep the snapshot alive,
+	/// so it can be iterated while the Graph is modified. ( the iteration does not allocate )
+	/// When some links of the snapshot are dead, the range holds the positions of the live ones.
+	template <typename T, typename Weight = double>
+	class NeighborRange
+	{
+	private:
+		std::shared_ptr<const CompactGraph<T, Weight>> compact;
+		std::vector<std::size_t> links;
+		std::size_t first = 0;
+		std::size_t last = 0;
+
+	public:
+		class iterator
+		{
+		private:
+			const CompactGraph<T, Weight> *compact = nullptr;
+			const std::size_t *links = nullptr;
+			std::size_t link = 0;
+
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = Neighbor<T, Weight>;
+			using difference_type = std::ptrdiff_t;
+			using pointer = void;
+			using reference = Neighbor<T, Weight>;
+
+			iterator() = default;
+			iterator(const CompactGraph<T, Weight> *compact, const std::size_t *links, std::size_t link) : compact(compact), links(links), link(link) {}
+			Neighbor<T, Weight> operator*() const
+			{
+				auto position = links ? links[link] : link;
+				const auto &record = compact->getRecords()[position];
+				return Neighbor<T, Weight>{compact->getNode(record.to), compact->getEdges()[position], record.weight};
+			}
+			iterator &operator++()
+			{
+				++link;
+				return *this;
+			}
+			iterator operator++(int)
+			{
+				iterator previous = *this;
+				++link;
+				return previous;
+			}
+			bool operator==(const iterator &other) const { return link == other.link && compact == other.compact; }
+			bool operator!=(const iterator &other) const { return !(*this == other); }
+		};
+
+		NeighborRange() = default;
+		NeighborRange(std::shared_ptr<const CompactGraph<T, Weight>> compact, std::size_t first, std::size_t last) : compact(std::move(compact)), first(first), last(last) {}
+		NeighborRange(std::shared_ptr<const CompactGraph<T, Weight>> compact, std::vector<std::size_t> links) : compact(std::move(compact)), links(std::move(links)), last(this->links.size()) {}
+		iterator begin() const { return iterator(compact.get(), links.empty() ? nullptr : links.data(), first); }
+		iterator end() const { return iterator(compact.get(), links.empty() ? nullptr : links.data(), last); }
+		std::size_t size() const { return last - first; }
+		bool empty() const { return first == last; }
+	};
+
+	template <typename T, typename Weight>
+	CompactGraph<T, Weight>::CompactGraph(const std::list<const Edge<T> *> &edgeSet)
+	{
+		// First pass: assign the dense indices and count the out degree of every node
+		std::vector<std::pair<DenseIndex, DenseIndex>> links;
+		links.reserve(edgeSet.size());
+		std::vector<std::size_t> degree;
+		for (auto edge : edgeSet)
+		{
+			auto from = nodeIndex.insert(edge->getNodePair().first);
+			auto to = nodeIndex.insert(edge->getNodePair().second);
+			links.emplace_back(from, to);
+			degree.resize(nodeIndex.size(), 0);
+			if (edge->isDirected().has_value())
+			{
+				degree[from]++;
+				if (!edge->isDirected().value())
+				{
+					degree[to]++;
+				}
+			}
+		}
+
+		offsets.assign(nodeIndex.size() + 1, 0);
+		for (std::size_t i = 0; i < nodeIndex.size(); ++i)
+		{
+			offsets[i + 1] = offsets[i] + degree[i];
+		}
+		records.resize(offsets.back());
+		this->edges.resize(offsets.back());
+
+		// Second pass: fill the links preserving the order of the Edge Set
+		std::vector<std::size_t> next(offsets.begin(), offsets.end() - 1);
+		auto fill = [this, &next](DenseIndex from, DenseIndex to, const Edge<T> *edge)
+		{
+			auto slot = next[from]++;
+			records[slot] = makeRecord(from, to, edge);
+			this->edges[slot] = edge;
+		};
+		auto linkIt = links.begin();
+		for (auto edgeIt = edgeSet.begin(); edgeIt != edgeSet.end(); ++edgeIt, ++linkIt)
+		{
+			const Edge<T> *edge = *edgeIt;
+			if (!edge->isDirected().has_value())
+			{
+				// a simple Edge has no direction, so it does not generate any link
+				continue;
+			}
+			fill(linkIt->first, linkIt->second, edge);
+			if (!edge->isDirected().value())
+			{
+				fill(linkIt->second, linkIt->first, edge);
+			}
+		}
+	}
+
+	template <typename T, typename Weight>
+	typename CompactGraph<T, Weight>::Record CompactGraph<T, Weight>::makeRecord(DenseIndex from, DenseIndex to, const Edge<T> *edge)
+	{
+		Weight weight = 0;
+		std::uint8_t flags = edge->isDirected().value() ? Record::DIRECTED : 0;
+		if (edge->isWeighted().has_value() && edge->isWeighted().value())
+		{
+			weight = static_cast<Weight>(dynamic_cast<const Weighted *>(edge)->getWeight());
+			flags |= Record::WEIGHTED;
+		}
+		return Record{from, to, weight, flags};
+	}
+
+	template <typename T, typename Weight>
+	std::size_t CompactGraph<T, Weight>::getNumberOfNodes() const
+	{
+		return nodeIndex.size();
+	}
+
+	template <typename T, typename Weight>
+	std::size_t CompactGraph<T, Weight>::getNumberOfLinks() const
+	{
+		return records.size();
+	}
+
+	template <typename T, typename Weight>
+	const std::optional<DenseIndex> CompactGraph<T, Weight>::getIndex(const Node<T> &node) const
+	{
+		return nodeIndex.getIndex(node);
+	}
+
+	template <typename T, typename Weight>
+	const Node<T> *CompactGraph<T, Weight>::getNode(DenseIndex index) const
+	{
+		return nodeIndex.getNode(index);
+	}
+
+	template <typename T, typename Weight>
+	std::size_t CompactGraph<T, Weight>::getOutDegree(DenseIndex index) const
+	{
+		return offsets[index + 1] - offsets[index];
+	}
+
+	template <typename T, typename Weight>
+	const std::vector<std::size_t> &CompactGraph<T, Weight>::getOffsets() const
+	{
+		return offsets;
+	}
+
+	template <typename T, typename Weight>
+	const std::vector<typename CompactGraph<T, Weight>::Record> &CompactGraph<T, Weight>::getRecords() const
+	{
+		return records;
+	}
+
+	template <typename T, typename Weight>
+	const std::vector<const Edge<T> *> &CompactGraph<T, Weight>::getEdges() const
+	{
+		return edges;
+	}
+
+	template <typename T, typename Weight>
+	const NodeIndex<T> &CompactGraph<T, Weight>::getNodeIndex() const
+	{
+		return nodeIndex;
+	}
+
+	template <typename T, typename Weight>
+	std::size_t CompactGraph<T, Weight>::memoryUsage() const
+	{
+		std::size_t usage = nodeIndex.memoryUsage() + CXXGRAPH::memoryUsage(offsets) + CXXGRAPH::memoryUsage(records) + CXXGRAPH::memoryUsage(edges);
+		if (reverseBuilt.load(std::memory_order_acquire))
+		{
+			usage += CXXGRAPH::memoryUsage(reverseOffsets) + CXXGRAPH::memoryUsage(reverseLinks);
+		}
+		return usage;
+	}
+
+	template <typename T, typename Weight>
+	template <typename Function>
+	void CompactGraph<T, Weight>::forEachLink(DenseIndex index, Function &&function) const
+	{
+		for (auto link = offsets[index]; link < offsets[index + 1]; ++link)
+		{
+			function(records[link]);
+		}
+	}
+
+	template <typename T, typename Weight>
+	void CompactGraph<T, Weight>::buildReverseIndex() const
+	{
+		std::call_once(reverseFlag, [this]()
+					   {
+						   // counting sort of the links by destination, stable so the Edge Set order is kept
+						   reverseOffsets.assign(nodeIndex.size() + 1, 0);
+						   for (const auto &record : records)
+						   {
+							   reverseOffsets[record.to + 1]++;
+						   }
+						   for (std::size_t i = 0; i < nodeIndex.size(); ++i)
+						   {
+							   reverseOffsets[i + 1] += reverseOffsets[i];
+						   }
+						   reverseLinks.resize(records.size());
+						   std::vector<std::size_t> next(reverseOffsets.begin(), reverseOffsets.end() - 1);
+						   for (std::size_t link = 0; link < records.size(); ++link)
+						   {
+							   reverseLinks[next[records[link].to]++] = link;
+						   }
+						   reverseBuilt.store(true, std::memory_order_release); });
+	}
+
+	template <typename T, typename Weight>
+	std::size_t CompactGraph<T, Weight>::getInDegree(DenseIndex index) const
+	{
+		buildReverseIndex();
+		return reverseOffsets[index + 1] - reverseOffsets[index];
+	}
+
+	template <typename T, typename Weight>
+	const std::vector<std::size_t> &CompactGraph<T, Weight>::getReverseOffsets() const
+	{
+		buildReverseIndex();
+		return reverseOffsets;
+	}
+
+	template <typename T, typename Weight>
+	const std::vector<std::size_t> &CompactGraph<T, Weight>::getReverseLinks() const
+	{
+		buildReverseIndex();
+		return reverseLinks;
+	}
+
+	template <typename T, typename Weight>
+	template <typename Function>
+	void CompactGraph<T, Weight>::forEachInLink(DenseIndex index, Function &&function) const
+	{
+		buildReverseIndex();
+		for (auto position = reverseOffsets[index]; position < reverseOffsets[index + 1]; ++position)
+		{
+			auto link = reverseLinks[position];
+			function(link, records[link]);
+		}
+	}
+}
+
+#endif // __COMPACTGRAPH_H__
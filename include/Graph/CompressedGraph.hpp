@@ -0,0 +1,355 @@
+/***********************************************************/
+/***      ______  ____  ______                 _         ***/
+/***     / ___\ \/ /\ \/ / ___|_ __ __ _ _ __ | |__	     ***/
+/***    | |    \  /  \  / |  _| '__/ _` | '_ \| '_ \	 ***/
+/***    | |___ /  \  /  \ |_| | | | (_| | |_) | | | |    ***/
+/***     \____/_/\_\/_/\_\____|_|  \__,_| .__/|_| |_|    ***/
+/***                                    |_|			     ***/
+/***********************************************************/
+/***     Header-Only C++ Library for Graph			     ***/
+/***	 Representation and Algorithms				     ***/
+/***********************************************************/
+/***     Author: ZigRazor			     			     ***/
+/***	 E-Mail: zigrazor@gmail.com 				     ***/
+/***********************************************************/
+/***	 Collaboration: ----------- 				     ***/
+/***********************************************************/
+/***	 License: AGPL v3.0							     ***/
+/***********************************************************/
+
+#ifndef __COMPRESSEDGRAPH_H__
+#define __COMPRESSEDGRAPH_H__
+
+#pragma once
+
+#include <list>
+#include <cmath>
+#include <vector>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <algorithm>
+#include <cstdint>
+
+#include "Node/Node.hpp"
+#include "Graph/NodeIndex.hpp"
+#include "Edge/Edge.hpp"
+#include "Edge/Weighted.hpp"
+#include "Graph/CompactGraph.hpp"
+
+namespace CXXGRAPH
+{
+	/// Class that implement an immutable compressed snapshot of a Graph, for graphs that barely fit in memory.
+	/// It is encoded straight from the Edge Set, without building the CSR snapshot first.
+	/// The run of bytes of every node starts with its out degree, then its outgoing links sorted by
+	/// destination and gap encoded with varints ( the first destination relative to the node itself,
+	/// the others relative to the previous one ), decoded on the fly while they are visited.
+	/// The flags of a link are packed in the low bits of its gap, unless all the links share them,
+	/// and the weights follow the gaps only if the Graph has at least a Weighted Edge: as varints
+	/// when they are all non negative integers, else in their binary form.
+	/// The Edge pointers are not kept.
+	template <typename T, typename Weight = double>
+	class CompressedGraph
+	{
+	public:
+		using Record = BasicEdgeRecord<Weight>;
+
+	private:
+		static constexpr unsigned int FLAG_BITS = 2;
+		NodeIndex<T> nodeIndex;
+		std::vector<std::size_t> byteOffsets;
+		std::vector<std::uint8_t> bytes;
+		std::size_t numberOfLinks = 0;
+		bool weighted = false;
+		bool integerWeights = true;
+		bool uniformFlags = true;
+		std::uint8_t commonFlags = 0;
+
+		void writeVarint(std::uint64_t value);
+		static std::uint64_t readVarint(const std::uint8_t *&cursor);
+
+	public:
+		CompressedGraph() = default;
+		CompressedGraph(const std::list<const Edge<T> *> &edgeSet);
+		~CompressedGraph() = default;
+		/**
+		* \brief
+		* Function that return the number of Nodes of the snapshot
+		*
+		* @returns the number of Nodes
+		*/
+		std::size_t getNumberOfNodes() const;
+		/**
+		* \brief
+		* Function that return the number of links of the snapshot
+		* ( an Undirected Edge is counted twice )
+		*
+		* @returns the number of links
+		*/
+		std::size_t getNumberOfLinks() const;
+		/**
+		* \brief
+		* Function that return the dense index of a Node
+		*
+		* @param node The Node to search
+		* @returns the index of the Node if it is inside the snapshot
+		*/
+		const std::optional<DenseIndex> getIndex(const Node<T> &node) const;
+		/**
+		* \brief
+		* Function that return the Node with a specific dense index
+		*
+		* @param index The dense index of the Node
+		* @returns the Node
+		*/
+		const Node<T> *getNode(DenseIndex index) const;
+		/**
+		* \brief
+		* Function that return the number of outgoing links of a Node
+		*
+		* @param index The dense index of the Node
+		* @returns the out degree of the Node
+		*/
+		std::size_t getOutDegree(DenseIndex index) const;
+		/**
+		* \brief
+		* Function that return the number of bytes used by the encoded links
+		*
+		* @returns the size of the encoded adjacency
+		*/
+		std::size_t getEncodedSize() const;
+		/**
+		* \brief
+		* Function that return an estimate of the memory used by the snapshot
+		*
+		* @returns the number of bytes
+		*/
+		std::size_t memoryUsage() const;
+		/**
+		* \brief
+		* Function that decode the outgoing links of a Node, in order of destination
+		*
+		* @param index The dense index of the Node
+		* @param function The function called with the Record of every link
+		*/
+		template <typename Function>
+		void forEachLink(DenseIndex index, Function &&function) const;
+	};
+
+	template <typename T, typename Weight>
+	CompressedGraph<T, Weight>::CompressedGraph(const std::list<const Edge<T> *> &edgeSet)
+	{
+		// First pass: assign the dense indices in the order of the CSR snapshot and count the out degrees
+		std::vector<std::size_t> offsets;
+		for (auto edge : edgeSet)
+		{
+			auto from = nodeIndex.insert(edge->getNodePair().first);
+			auto to = nodeIndex.insert(edge->getNodePair().second);
+			offsets.resize(nodeIndex.size() + 1, 0);
+			if (edge->isDirected().has_value())
+			{
+				offsets[from + 1]++;
+				if (!edge->isDirected().value())
+				{
+					offsets[to + 1]++;
+				}
+			}
+		}
+		offsets.resize(nodeIndex.size() + 1, 0);
+		for (std::size_t i = 0; i < nodeIndex.size(); ++i)
+		{
+			offsets[i + 1] += offsets[i];
+		}
+		numberOfLinks = offsets.back();
+
+		// Second pass: the links grouped by source node, the only temporary as large as the Edge Set.
+		// The dense indices are looked up again instead of being kept from the first pass
+		struct Link
+		{
+			DenseIndex to;
+			Weight weight;
+			std::uint8_t flags;
+		};
+		std::vector<Link> links(numberOfLinks);
+		{
+			std::vector<std::size_t> next(offsets.begin(), offsets.end() - 1);
+			for (auto edge : edgeSet)
+			{
+				if (!edge->isDirected().has_value())
+				{
+					// a simple Edge has no direction, so it does not generate any link
+					continue;
+				}
+				auto from = nodeIndex.insert(edge->getNodePair().first);
+				auto to = nodeIndex.insert(edge->getNodePair().second);
+				Weight weight = 0;
+				std::uint8_t flags = edge->isDirected().value() ? Record::DIRECTED : 0;
+				if (edge->isWeighted().has_value() && edge->isWeighted().value())
+				{
+					weight = static_cast<Weight>(dynamic_cast<const Weighted *>(edge)->getWeight());
+					flags |= Record::WEIGHTED;
+					weighted = true;
+					// 2^53 keeps every integer exact in a double
+					if (!(weight >= 0 && weight < 9007199254740992.0 && std::floor(weight) == weight))
+					{
+						integerWeights = false;
+					}
+				}
+				links[next[from]++] = Link{to, weight, flags};
+				if (!edge->isDirected().value())
+				{
+					links[next[to]++] = Link{from, weight, flags};
+				}
+			}
+		}
+		if (numberOfLinks > 0)
+		{
+			commonFlags = links.front().flags;
+			uniformFlags = std::all_of(links.begin(), links.end(), [this](const Link &link)
+									   { return link.flags == commonFlags; });
+		}
+
+		byteOffsets.reserve(nodeIndex.size());
+		for (std::size_t node = 0; node < nodeIndex.size(); ++node)
+		{
+			byteOffsets.push_back(bytes.size());
+			writeVarint(offsets[node + 1] - offsets[node]);
+			// sort the links of the node by destination, the sort is stable to keep parallel edges in order
+			std::stable_sort(links.begin() + offsets[node], links.begin() + offsets[node + 1], [](const Link &a, const Link &b)
+							 { return a.to < b.to; });
+			std::int64_t previous = node;
+			for (auto link = offsets[node]; link < offsets[node + 1]; ++link)
+			{
+				std::int64_t gap = static_cast<std::int64_t>(links[link].to) - previous;
+				// the first gap can be negative, so it is zig-zag encoded
+				std::uint64_t value = link == offsets[node] ? (gap < 0 ? (static_cast<std::uint64_t>(-gap) << 1) - 1 : static_cast<std::uint64_t>(gap) << 1) : static_cast<std::uint64_t>(gap);
+				if (!uniformFlags)
+				{
+					value = (value << FLAG_BITS) | links[link].flags;
+				}
+				writeVarint(value);
+				previous = links[link].to;
+				if (weighted && integerWeights)
+				{
+					writeVarint(static_cast<std::uint64_t>(links[link].weight));
+				}
+				else if (weighted)
+				{
+					std::uint8_t raw[sizeof(Weight)];
+					std::memcpy(raw, &links[link].weight, sizeof(Weight));
+					bytes.insert(bytes.end(), raw, raw + sizeof(Weight));
+				}
+			}
+		}
+		bytes.shrink_to_fit();
+	}
+
+	template <typename T, typename Weight>
+	void CompressedGraph<T, Weight>::writeVarint(std::uint64_t value)
+	{
+		while (value >= 0x80)
+		{
+			bytes.push_back(static_cast<std::uint8_t>(value | 0x80));
+			value >>= 7;
+		}
+		bytes.push_back(static_cast<std::uint8_t>(value));
+	}
+
+	template <typename T, typename Weight>
+	std::uint64_t CompressedGraph<T, Weight>::readVarint(const std::uint8_t *&cursor)
+	{
+		std::uint64_t value = 0;
+		unsigned int shift = 0;
+		while (*cursor & 0x80)
+		{
+			value |= static_cast<std::uint64_t>(*cursor++ & 0x7f) << shift;
+			shift += 7;
+		}
+		value |= static_cast<std::uint64_t>(*cursor++) << shift;
+		return value;
+	}
+
+	template <typename T, typename Weight>
+	std::size_t CompressedGraph<T, Weight>::getNumberOfNodes() const
+	{
+		return nodeIndex.size();
+	}
+
+	template <typename T, typename Weight>
+	std::size_t CompressedGraph<T, Weight>::getNumberOfLinks() const
+	{
+		return numberOfLinks;
+	}
+
+	template <typename T, typename Weight>
+	const std::optional<DenseIndex> CompressedGraph<T, Weight>::getIndex(const Node<T> &node) const
+	{
+		return nodeIndex.getIndex(node);
+	}
+
+	template <typename T, typename Weight>
+	const Node<T> *CompressedGraph<T, Weight>::getNode(DenseIndex index) const
+	{
+		return nodeIndex.getNode(index);
+	}
+
+	template <typename T, typename Weight>
+	std::size_t CompressedGraph<T, Weight>::getOutDegree(DenseIndex index) const
+	{
+		const std::uint8_t *cursor = bytes.data() + byteOffsets[index];
+		return readVarint(cursor);
+	}
+
+	template <typename T, typename Weight>
+	std::size_t CompressedGraph<T, Weight>::getEncodedSize() const
+	{
+		return bytes.size();
+	}
+
+	template <typename T, typename Weight>
+	std::size_t CompressedGraph<T, Weight>::memoryUsage() const
+	{
+		return nodeIndex.memoryUsage() + CXXGRAPH::memoryUsage(byteOffsets) + CXXGRAPH::memoryUsage(bytes);
+	}
+
+	template <typename T, typename Weight>
+	template <typename Function>
+	void CompressedGraph<T, Weight>::forEachLink(DenseIndex index, Function &&function) const
+	{
+		const std::uint8_t *cursor = bytes.data() + byteOffsets[index];
+		auto degree = readVarint(cursor);
+		std::int64_t previous = index;
+		for (std::uint64_t link = 0; link < degree; ++link)
+		{
+			std::uint64_t value = readVarint(cursor);
+			std::uint8_t flags = commonFlags;
+			if (!uniformFlags)
+			{
+				flags = static_cast<std::uint8_t>(value & ((1u << FLAG_BITS) - 1));
+				value >>= FLAG_BITS;
+			}
+			if (link == 0)
+			{
+				previous += (value & 1) ? -static_cast<std::int64_t>((value + 1) >> 1) : static_cast<std::int64_t>(value >> 1);
+			}
+			else
+			{
+				previous += static_cast<std::int64_t>(value);
+			}
+			Weight weight = 0;
+			if (weighted && integerWeights)
+			{
+				weight = static_cast<Weight>(readVarint(cursor));
+			}
+			else if (weighted)
+			{
+				std::memcpy(&weight, cursor, sizeof(Weight));
+				cursor += sizeof(Weight);
+			}
+			Record record{index, static_cast<DenseIndex>(previous), weight, flags};
+			function(record);
+		}
+	}
+}
+
+#endif // __COMPRESSEDGRAPH_H__
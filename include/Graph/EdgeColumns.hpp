@@ -0,0 +1,258 @@
+/***********************************************************/
+/***      ______  ____  ______                 _         ***/
+/***     / ___\ \/ /\ \/ / ___|_ __ __ _ _ __ | |__	     ***/
+/***    | |    \  /  \  / |  _| '__/ _` | '_ \| '_ \	 ***/
+/***    | |___ /  \  /  \ |_| | | | (_| | |_) | | | |    ***/
+/***     \____/_/\_\/_/\_\____|_|  \__,_| .__/|_| |_|    ***/
+/***                                    |_|			     ***/
+/***********************************************************/
+/***     Header-Only C++ Library for Graph			     ***/
+/***	 Representation and Algorithms				     ***/
+/***********************************************************/
+/***     Author: ZigRazor			     			     ***/
+/***	 E-Mail: zigrazor@gmail.com 				     ***/
+/***********************************************************/
+/***	 Collaboration: ----------- 				     ***/
+/***********************************************************/
+/***	 License: AGPL v3.0							     ***/
+/***********************************************************/
+
+#ifndef __EDGECOLUMNS_H__
+#define __EDGECOLUMNS_H__
+
+#pragma once
+
+#include <list>
+#include <vector>
+#include <cstdint>
+
+#include "Node/Node.hpp"
+#include "Edge/Edge.hpp"
+#include "Edge/Weighted.hpp"
+#include "Graph/NodeIndex.hpp"
+#include "Utility/MemoryUsage.hpp"
+
+namespace CXXGRAPH
+{
+	/// Class that implement an immutable Structure of Arrays snapshot of the Edge Set.
+	/// Row i of every column describes the i-th Edge of the Edge Set, so scans over a
+	/// single property read one contiguous array instead of calling the Edge objects.
+	template <typename T>
+	class EdgeColumns
+	{
+	private:
+		NodeIndex<T> nodeIndex;
+		std::vector<unsigned long> ids;
+		std::vector<DenseIndex> sources;
+		std::vector<DenseIndex> targets;
+		std::vector<double> weights;
+		std::vector<std::uint8_t> directed;
+		std::vector<std::uint8_t> weighted;
+
+	public:
+		EdgeColumns() = default;
+		EdgeColumns(const std::list<const Edge<T> *> &edgeSet);
+		~EdgeColumns() = default;
+		/**
+		* \brief
+		* Function that return the number of Edges
+		*
+		* @returns the number of rows of the columns
+		*/
+		std::size_t size() const;
+		/**
+		* \brief
+		* Function that return the column of the Edge ids
+		*
+		* @returns the id column
+		*/
+		const std::vector<unsigned long> &getIds() const;
+		/**
+		* \brief
+		* Function that return the column of the dense indices of the first Node of the Edges
+		*
+		* @returns the source column
+		*/
+		const std::vector<DenseIndex> &getSources() const;
+		/**
+		* \brief
+		* Function that return the column of the dense indices of the second Node of the Edges
+		*
+		* @returns the target column
+		*/
+		const std::vector<DenseIndex> &getTargets() const;
+		/**
+		* \brief
+		* Function that return the column of the weights ( 0.0 for not Weighted Edge )
+		*
+		* @returns the weight column
+		*/
+		const std::vector<double> &getWeights() const;
+		/**
+		* \brief
+		* Function that return the column of the directed flags ( 1 for Directed Edge )
+		*
+		* @returns the directed column
+		*/
+		const std::vector<std::uint8_t> &getDirected() const;
+		/**
+		* \brief
+		* Function that return the column of the weighted flags ( 1 for Weighted Edge )
+		*
+		* @returns the weighted column
+		*/
+		const std::vector<std::uint8_t> &getWeighted() const;
+		/**
+		* \brief
+		* Function that return the mapping between the Nodes and their dense indices
+		*
+		* @returns the Node Index of the columns
+		*/
+		const NodeIndex<T> &getNodeIndex() const;
+		/**
+		* \brief
+		* Function that check if all the Edges are Directed
+		*
+		* @returns true if all the Edges are Directed
+		*/
+		bool isAllDirected() const;
+		/**
+		* \brief
+		* Function that return the sum of the weights of the Weighted Edges
+		*
+		* @returns the total weight
+		*/
+		double getTotalWeight() const;
+		/**
+		* \brief
+		* Function that return the maximum weight of the Weighted Edges
+		*
+		* @returns the maximum weight, 0.0 if there is no Weighted Edge
+		*/
+		double getMaxWeight() const;
+		/**
+		* \brief
+		* Function that return an estimate of the memory used by the columns
+		*
+		* @returns the number of bytes
+		*/
+		std::size_t memoryUsage() const;
+	};
+
+	template <typename T>
+	EdgeColumns<T>::EdgeColumns(const std::list<const Edge<T> *> &edgeSet)
+	{
+		ids.reserve(edgeSet.size());
+		sources.reserve(edgeSet.size());
+		targets.reserve(edgeSet.size());
+		weights.reserve(edgeSet.size());
+		directed.reserve(edgeSet.size());
+		weighted.reserve(edgeSet.size());
+		for (auto edge : edgeSet)
+		{
+			ids.push_back(edge->getId());
+			sources.push_back(nodeIndex.insert(edge->getNodePair().first));
+			targets.push_back(nodeIndex.insert(edge->getNodePair().second));
+			directed.push_back(edge->isDirected().has_value() && edge->isDirected().value());
+			bool isWeighted = edge->isWeighted().has_value() && edge->isWeighted().value();
+			weighted.push_back(isWeighted);
+			weights.push_back(isWeighted ? dynamic_cast<const Weighted *>(edge)->getWeight() : 0.0);
+		}
+	}
+
+	template <typename T>
+	std::size_t EdgeColumns<T>::size() const
+	{
+		return ids.size();
+	}
+
+	template <typename T>
+	const std::vector<unsigned long> &EdgeColumns<T>::getIds() const
+	{
+		return ids;
+	}
+
+	template <typename T>
+	const std::vector<DenseIndex> &EdgeColumns<T>::getSources() const
+	{
+		return sources;
+	}
+
+	template <typename T>
+	const std::vector<DenseIndex> &EdgeColumns<T>::getTargets() const
+	{
+		return targets;
+	}
+
+	template <typename T>
+	const std::vector<double> &EdgeColumns<T>::getWeights() const
+	{
+		return weights;
+	}
+
+	template <typename T>
+	const std::vector<std::uint8_t> &EdgeColumns<T>::getDirected() const
+	{
+		return directed;
+	}
+
+	template <typename T>
+	const std::vector<std::uint8_t> &EdgeColumns<T>::getWeighted() const
+	{
+		return weighted;
+	}
+
+	template <typename T>
+	const NodeIndex<T> &EdgeColumns<T>::getNodeIndex() const
+	{
+		return nodeIndex;
+	}
+
+	template <typename T>
+	bool EdgeColumns<T>::isAllDirected() const
+	{
+		// branchless reduction, so the compiler can vectorize the scan
+		std::uint8_t result = 1;
+		for (auto flag : directed)
+		{
+			result &= flag;
+		}
+		return result;
+	}
+
+	template <typename T>
+	double EdgeColumns<T>::getTotalWeight() const
+	{
+		// not Weighted Edges have weight 0.0, so they do not change the sum
+		double result = 0.0;
+		for (auto weight : weights)
+		{
+			result += weight;
+		}
+		return result;
+	}
+
+	template <typename T>
+	double EdgeColumns<T>::getMaxWeight() const
+	{
+		double result = 0.0;
+		bool found = false;
+		for (std::size_t i = 0; i < weights.size(); ++i)
+		{
+			if (weighted[i] && (!found || weights[i] > result))
+			{
+				result = weights[i];
+				found = true;
+			}
+		}
+		return result;
+	}
+
+	template <typename T>
+	std::size_t EdgeColumns<T>::memoryUsage() const
+	{
+		return nodeIndex.memoryUsage() + CXXGRAPH::memoryUsage(ids) + CXXGRAPH::memoryUsage(sources) + CXXGRAPH::memoryUsage(targets) + CXXGRAPH::memoryUsage(weights) + CXXGRAPH::memoryUsage(directed) + CXXGRAPH::memoryUsage(weighted);
+	}
+}
+
+#endif // __EDGECOLUMNS_H__
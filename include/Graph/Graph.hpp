@@ -23,6 +23,7 @@
 #pragma once
 
 #include <utility>
+#include <algorithm>
 #include <set>
 #include <map>
 #include <optional>
@@ -40,6 +41,8 @@
 #include <atomic>
 #include <thread>
 #include <cmath>
+#include <memory>
+#include <unordered_map>
 #include "zlib.h"
 
 #include "Edge/Weighted.hpp"
@@ -55,8 +58,16 @@
 #include "Utility/ConstString.hpp"
 #include "Utility/ConstValue.hpp"
 #include "Utility/Typedef.hpp"
+#include "Utility/Arena.hpp"
+#include "Utility/Barrier.hpp"
+#include "Utility/IndexedHeap.hpp"
+#include "Utility/RadixHeap.hpp"
+#include "Utility/MemoryUsage.hpp"
 #include "Partitioning/Partition.hpp"
 #include "Partitioning/PartitionAlgorithm.hpp"
+#include "Graph/CompactGraph.hpp"
+#include "Graph/CompressedGraph.hpp"
+#include "Graph/EdgeColumns.hpp"
 
 namespace CXXGRAPH
 {
@@ -66,17 +77,218 @@ namespace CXXGRAPH
 	}
 
 	template <typename T>
-	std::ostream &operator<<(std::ostream &o, const Graph<T> &graph);
+	class Graph_TS;
+
+	template <typename T, typename Policy>
+	std::ostream &operator<<(std::ostream &o, const Graph<T, Policy> &graph);
 	template <typename T>
 	std::ostream &operator<<(std::ostream &o, const AdjacencyMatrix<T> &adj);
 
 	/// Class that implement the Graph. ( This class is not Thread Safe )
-	template <typename T>
+	/// The Policy ( see GraphPolicy ) fix at compile time the kind of the accepted Edges
+	/// and the weight type of the snapshots, so the algorithms can drop the runtime checks.
+	template <typename T, typename Policy>
 	class Graph
 	{
 	private:
 		std::list<const Edge<T> *> edgeSet;
+		std::unordered_multimap<unsigned long, typename std::list<const Edge<T> *>::iterator> edgeIndex;
+		/// Hash of the ( source id, destination id ) key of the Node Pair Index
+		struct NodePairHash
+		{
+			std::size_t operator()(const std::pair<unsigned long, unsigned long> &key) const
+			{
+				std::size_t seed = std::hash<unsigned long>()(key.first);
+				seed ^= std::hash<unsigned long>()(key.second) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+				return seed;
+			}
+		};
+		// every link of the Graph keyed by the ids of its Nodes, an Undirected Edge is indexed in both directions
+		std::unordered_multimap<std::pair<unsigned long, unsigned long>, const Edge<T> *, NodePairHash> pairIndex;
+		std::list<const Node<T> *> nodeSet;
+		std::unordered_map<unsigned long, std::pair<typename std::list<const Node<T> *>::iterator, unsigned long>> nodeRegistry;
+		AdjacencyMatrix<T> adjMatrix;
+		mutable std::shared_ptr<const CompactGraph<T, typename Policy::Weight>> compactGraph;
+		bool compressedAdjacency = false;
+		mutable std::shared_ptr<const CompressedGraph<T, typename Policy::Weight>> compressedGraph;
+		mutable std::shared_ptr<const EdgeColumns<T>> edgeColumns;
+		// links of the CSR snapshot whose Edge has been removed in tombstone mode
+		bool tombstoneRemoval = false;
+		double compactionThreshold = DEFAULT_COMPACTION_THRESHOLD;
+		mutable std::vector<bool> tombstones;
+		mutable std::size_t numberOfTombstones = 0;
+		/// Links of the Edges added after the CSR snapshot was built. The Nodes new to the snapshot
+		/// take the dense indices that follow its V Nodes, the links are grouped by source and destination
+		struct AppendedLinks
+		{
+			NodeIndex<T> nodes;
+			std::vector<typename CompactGraph<T, typename Policy::Weight>::Record> records;
+			std::vector<const Edge<T> *> edges;
+			std::vector<std::vector<std::size_t>> out;
+			std::vector<std::vector<std::size_t>> in;
+		};
+		mutable AppendedLinks appended;
+		/// View of the CSR snapshot that hides the tombstones and the Nodes no more in the Graph,
+		/// and adds the links appended after the snapshot was built
+		class LiveCompactGraph
+		{
+		private:
+			const Graph<T, Policy> &graph;
+			const CompactGraph<T, typename Policy::Weight> &compact;
+
+		public:
+			LiveCompactGraph(const Graph<T, Policy> &graph, const CompactGraph<T, typename Policy::Weight> &compact) : graph(graph), compact(compact) {}
+			std::size_t getNumberOfNodes() const { return compact.getNumberOfNodes() + graph.appended.nodes.size(); }
+			const std::optional<DenseIndex> getIndex(const Node<T> &node) const
+			{
+				auto index = graph.getLiveIndex(compact, node);
+				if (index.has_value() || compact.getIndex(node).has_value())
+				{
+					return index;
+				}
+				auto appendedIndex = graph.appended.nodes.getIndex(node);
+				if (!appendedIndex.has_value() || graph.nodeRegistry.find(node.getId()) == graph.nodeRegistry.end())
+				{
+					return std::nullopt;
+				}
+				return compact.getNumberOfNodes() + appendedIndex.value();
+			}
+			const Node<T> *getNode(DenseIndex index) const
+			{
+				if (index < compact.getNumberOfNodes())
+				{
+					return compact.getNode(index);
+				}
+				return graph.appended.nodes.getNode(index - compact.getNumberOfNodes());
+			}
+			template <typename Function>
+			void forEachLink(DenseIndex index, Function &&function) const
+			{
+				if (index < compact.getNumberOfNodes())
+				{
+					const auto &offsets = compact.getOffsets();
+					const auto &records = compact.getRecords();
+					for (auto link = offsets[index]; link < offsets[index + 1]; ++link)
+					{
+						if (!graph.isTombstone(link))
+						{
+							function(records[link]);
+						}
+					}
+				}
+				if (index < graph.appended.out.size())
+				{
+					for (auto position : graph.appended.out[index])
+					{
+						function(graph.appended.records[position]);
+					}
+				}
+			}
+			template <typename Function>
+			void forEachInLink(DenseIndex index, Function &&function) const
+			{
+				if (index < compact.getNumberOfNodes())
+				{
+					compact.forEachInLink(index, [this, &function](std::size_t link, const auto &record)
+										  {
+											  if (!graph.isTombstone(link))
+											  {
+												  function(link, record);
+											  } });
+				}
+				if (index < graph.appended.in.size())
+				{
+					// the appended links follow the links of the snapshot
+					for (auto position : graph.appended.in[index])
+					{
+						function(compact.getNumberOfLinks() + position, graph.appended.records[position]);
+					}
+				}
+			}
+		};
+		// owns the Nodes and the Edges created by the Graph itself, only this Graph allocates from it
+		std::shared_ptr<Arena> arena;
+		// the arenas of the Graphs this one is copied from, they keep alive the Nodes and the Edges
+		// of the copied Edge Set but they are never allocated from, the Arena is not Thread Safe
+		std::vector<std::shared_ptr<const Arena>> inheritedArenas;
+		Arena &getArena();
+		void inheritArenas(const Graph<T, Policy> &graph);
+		// the copy is split in two steps, so that Graph_TS copies only the Edge Set and the
+		// still valid snapshots under its lock, and builds the indexes after releasing it
+		void copyEdgeSet(const Graph<T, Policy> &graph);
+		void indexEdgeSet();
+		friend class Graph_TS<T>;
+		// the CSR snapshot with the appended links folded in, and the snapshot as it was built
+		const std::shared_ptr<const CompactGraph<T, typename Policy::Weight>> getCompactGraph() const;
+		const std::shared_ptr<const CompactGraph<T, typename Policy::Weight>> getBaseCompactGraph() const;
+		bool isSnapshotPatched() const;
+		void appendToSnapshots(const Edge<T> *edge);
+		const std::shared_ptr<const CompressedGraph<T, typename Policy::Weight>> getCompressedGraph() const;
+		const std::shared_ptr<const EdgeColumns<T>> getColumns() const;
+		void resetSnapshots();
+		void clearMovedFrom() noexcept;
+		void markTombstones(const Edge<T> *edge);
+		void compactSnapshots() const;
+		bool isTombstone(std::size_t link) const;
+		const std::optional<DenseIndex> getLiveIndex(const CompactGraph<T, typename Policy::Weight> &compact, const Node<T> &node) const;
+		/// State of a shortest path search, reused by the searches run by the same thread
+		struct ShortestPathWorkspace
+		{
+			std::vector<double> dist;
+			std::vector<DenseIndex> predecessor;
+			IndexedHeap<double> heap;
+			// the nodes reached by the last search, the only ones to reset
+			std::vector<DenseIndex> touched;
+			explicit ShortestPathWorkspace(std::size_t numberOfNodes) : dist(numberOfNodes, INF_DOUBLE), predecessor(numberOfNodes), heap(numberOfNodes)
+			{
+				for (DenseIndex node = 0; node < numberOfNodes; ++node)
+				{
+					predecessor[node] = node;
+				}
+			}
+			void clear()
+			{
+				for (auto node : touched)
+				{
+					dist[node] = INF_DOUBLE;
+					predecessor[node] = node;
+				}
+				touched.clear();
+				heap.clear();
+			}
+		};
+		template <typename Adjacency, typename Settled>
+		static bool runShortestPaths(const Adjacency &adjacency, DenseIndex source, ShortestPathWorkspace &workspace, Settled &&settled);
+		template <typename Adjacency>
+		static const DijkstraResult runDijkstra(const Adjacency &adjacency, const Node<T> &source, const Node<T> &target);
+		template <typename Adjacency>
+		static const DijkstraResult runBidirectionalDijkstra(const Adjacency &adjacency, const Node<T> &source, const Node<T> &target);
+		template <typename Adjacency, typename Heuristic>
+		static const DijkstraResult runAstar(const Adjacency &adjacency, const Node<T> &source, const Node<T> &target, Heuristic &&heuristic);
+		template <typename Adjacency>
+		static const DijkstraAllResult runDijkstraAll(const Adjacency &adjacency, const Node<T> &source);
+		template <typename Adjacency>
+		static const DijkstraBatchResult runDijkstraBatch(const Adjacency &adjacency, const std::vector<const Node<T> *> &sources, const std::vector<const Node<T> *> &targets, unsigned int numberOfThreads);
+		template <typename Adjacency>
+		static void runDeltaStepping(const Adjacency &adjacency, DenseIndex source, double delta, unsigned int numberOfThreads, std::vector<double> &distances);
+		template <typename Adjacency>
+		static const std::vector<Node<T>> runBreadthFirstSearch(const Adjacency &adjacency, const Node<T> &start);
+		template <typename Adjacency>
+		static const std::vector<Node<T>> runDepthFirstSearch(const Adjacency &adjacency, const Node<T> &start);
+		typename std::list<const Edge<T> *>::iterator findEdge(const Edge<T> *edge);
+		static bool acceptsEdge(const Edge<T> *edge);
+		bool insertEdge(const Edge<T> *edge);
+		void insertEdges(const std::vector<const Edge<T> *> &edges);
+		void indexEdge(typename std::list<const Edge<T> *>::iterator edgeSetIt);
+		void indexNodePair(const Edge<T> *edge);
+		void unindexNodePair(const Edge<T> *edge);
+		template <typename Function>
+		void forEachLinkKey(const Edge<T> *edge, Function &&function) const;
+		static bool linksNodes(const Edge<T> *edge, const Node<T> &nodeFrom, const Node<T> &nodeTo);
+		void registerNode(const Node<T> *node);
+		void unregisterNode(const Node<T> *node);
 		void addElementToAdjMatrix(AdjacencyMatrix<T> &adjMatrix, const Node<T> *nodeFrom, const Node<T> *nodeTo, const Edge<T> *edge) const;
+		void removeElementFromAdjMatrix(AdjacencyMatrix<T> &adjMatrix, const Node<T> *nodeFrom, const Edge<T> *edge) const;
 		int writeToStandardFile_csv(const std::string &workingDir, const std::string &OFileName, bool compress, bool writeNodeFeat, bool writeEdgeWeight) const;
 		int readFromStandardFile_csv(const std::string &workingDir, const std::string &OFileName, bool compress, bool readNodeFeat, bool readEdgeWeight);
 		int writeToStandardFile_tsv(const std::string &workingDir, const std::string &OFileName, bool compress, bool writeNodeFeat, bool writeEdgeWeight) const;
@@ -90,16 +302,24 @@ namespace CXXGRAPH
 	public:
 		Graph() = default;
 		Graph(const std::list<const Edge<T> *> &edgeSet);
+		/// The nodes of the list are taken over, without copying the Edge Set
+		Graph(std::list<const Edge<T> *> &&edgeSet);
+		Graph(const Graph<T, Policy> &graph);
+		/// The moved Graph is left empty, the owned Nodes and Edges are transferred
+		Graph(Graph<T, Policy> &&graph) noexcept;
 		~Graph() = default;
+		Graph<T, Policy> &operator=(const Graph<T, Policy> &graph);
+		Graph<T, Policy> &operator=(Graph<T, Policy> &&graph) noexcept;
 		/**
  		* \brief
  		* Function that return the Edge set of the Graph
 		* Note: No Thread Safe
 		*
- 		* @returns a list of Edges of the graph
+ 		* @returns a copy of the list of Edges of the graph, so Graph_TS can return it
+		* taken under its lock
  		*
  		*/
-		virtual const std::list<const Edge<T> *> &getEdgeSet() const;
+		virtual const std::list<const Edge<T> *> getEdgeSet() const;
 		/**
  		* \brief
  		* Function set the Edge Set of the Graph
@@ -111,7 +331,9 @@ namespace CXXGRAPH
 		virtual void setEdgeSet(std::list<const Edge<T> *> &edgeSet);
 		/**
  		* \brief
- 		* Function add an Edge to the Graph Edge Set
+ 		* Function add an Edge to the Graph Edge Set.
+		* An Edge that does not match the GraphPolicy is discarded.
+		* The links of the Edge are appended next to the CSR snapshot, which is not rebuilt.
 		* Note: No Thread Safe
  		*
  		* @param edge The Edge to insert
@@ -120,6 +342,53 @@ namespace CXXGRAPH
 		virtual void addEdge(const Edge<T> *edge);
 		/**
  		* \brief
+ 		* Function add an Edge to the Graph Edge Set and give its ownership to the Graph.
+		* The Edge lives as long as the Graph or one of its copies.
+		* An Edge discarded as duplicate or not matching the GraphPolicy is destroyed.
+		* Note: No Thread Safe
+ 		*
+ 		* @param edge The Edge to insert
+ 		* @returns the inserted Edge, or nullptr if it has been discarded
+ 		*
+ 		*/
+		virtual const Edge<T> *addEdge(std::unique_ptr<const Edge<T>> edge);
+		/**
+ 		* \brief
+ 		* Function that create a Node owned by the Graph, to be used by the owned Edges.
+		* The Node is part of the Node Set only when an Edge refer to it.
+		* Note: No Thread Safe
+ 		*
+ 		* @param id The id of the Node
+ 		* @param data The data of the Node
+ 		* @returns the created Node, valid as long as the Graph or one of the copies made after
+ 		*
+ 		*/
+		virtual const Node<T> *createNode(unsigned long id, const T &data);
+		/**
+ 		* \brief
+ 		* Function add a batch of Edges to the Graph Edge Set.
+		* Duplicates, inside the batch or already in the Graph, are discarded
+		* with a single hash lookup per Edge. Their links are appended next to the CSR snapshot,
+		* that is dropped once they cross the compaction threshold.
+		* Note: No Thread Safe
+ 		*
+ 		* @param edges The Edges to insert
+ 		*
+ 		*/
+		virtual void addEdges(const std::vector<const Edge<T> *> &edges);
+		/**
+ 		* \brief
+ 		* Function add a range of Edges to the Graph Edge Set, as a single batch
+		* Note: No Thread Safe
+ 		*
+ 		* @param begin The iterator to the first Edge to insert
+ 		* @param end The iterator past the last Edge to insert
+ 		*
+ 		*/
+		template <typename InputIt>
+		void addEdges(InputIt begin, InputIt end);
+		/**
+ 		* \brief
  		* Function remove an Edge from the Graph Edge Set
 		* Note: No Thread Safe
  		*
@@ -138,6 +407,87 @@ namespace CXXGRAPH
 		virtual const std::list<const Node<T> *> getNodeSet() const;
 		/**
  		* \brief
+ 		* Function that return a Node with specific ID if Exist in the Graph
+		* Note: No Thread Safe
+ 		*
+		* @param nodeId The Node Id to return
+ 		* @returns the Node if exist
+ 		*
+ 		*/
+		virtual const std::optional<const Node<T> *> getNode(unsigned long nodeId) const;
+		/**
+ 		* \brief
+ 		* Function that return the number of links that enter a Node.
+		* It is answered by the reverse index of the CSR snapshot, built on first use.
+		* An Undirected Edge enter both its Nodes.
+		* Note: No Thread Safe
+ 		*
+		* @param node The Node
+ 		* @returns the in degree of the Node, 0 if the Node is not in the Graph
+ 		*
+ 		*/
+		virtual std::size_t getInDegree(const Node<T> &node) const;
+		/**
+ 		* \brief
+ 		* Function that return the source Nodes of the links that enter a Node,
+		* in order of the Edge Set, without scanning the Edges
+		* Note: No Thread Safe
+ 		*
+		* @param node The Node
+ 		* @returns the predecessors of the Node, one for each incoming link
+ 		*
+ 		*/
+		virtual const std::vector<const Node<T> *> getPredecessors(const Node<T> &node) const;
+		/**
+ 		* \brief
+ 		* Function that check if there is a link from a Node to another Node, with a single
+		* lookup in the Node Pair Index. An Undirected Edge link its Nodes in both directions.
+		* Note: No Thread Safe
+ 		*
+		* @param nodeFrom The source Node
+		* @param nodeTo The destination Node
+ 		* @returns true if an Edge link nodeFrom to nodeTo
+ 		*
+ 		*/
+		virtual bool hasEdge(const Node<T> &nodeFrom, const Node<T> &nodeTo) const;
+		/**
+ 		* \brief
+ 		* Function that return all the Edges that link a Node to another Node
+		* Note: No Thread Safe
+ 		*
+		* @param nodeFrom The source Node
+		* @param nodeTo The destination Node
+ 		* @returns the Edges that link nodeFrom to nodeTo, in no particular order
+ 		*
+ 		*/
+		virtual const std::vector<const Edge<T> *> getEdgesBetween(const Node<T> &nodeFrom, const Node<T> &nodeTo) const;
+		/**
+ 		* \brief
+ 		* Function that call a function for every outgoing link of a Node, with the Node
+		* at the other end, the Edge of the link and its weight. Nothing is copied or allocated
+		* during the iteration, the links are read from the CSR snapshot of the Graph.
+		* Note: Thread Safe on a Graph_TS, only the range of neighbors is taken under lock
+ 		*
+		* @param node The Node
+		* @param function The function called as function(const Node<T> *neighbor, const Edge<T> *edge, Weight weight)
+ 		*
+ 		*/
+		template <typename Function>
+		void forEachNeighbor(const Node<T> &node, Function &&function) const;
+		/**
+ 		* \brief
+ 		* Function that return a range over the outgoing links of a Node, for range-based for loops.
+		* The range hold the CSR snapshot, so it stay valid if the Graph is modified.
+		* In tombstone mode the snapshot is not rebuilt, the range keeps the positions of the live links.
+		* Note: No Thread Safe
+ 		*
+		* @param node The Node
+ 		* @returns the range of the Neighbors of the Node, empty if the Node is not in the Graph
+ 		*
+ 		*/
+		virtual NeighborRange<T, typename Policy::Weight> neighbors(const Node<T> &node) const;
+		/**
+ 		* \brief
  		* Function that return an Edge with specific ID if Exist in the Graph
 		* Note: No Thread Safe
  		*
@@ -147,15 +497,125 @@ namespace CXXGRAPH
  		*/
 		virtual const std::optional<const Edge<T> *> getEdge(unsigned long edgeId) const;
 		/**
-		* @brief This function generate a list of adjacency matrix with every element of the matrix
-		* contain the node where is directed the link and the Edge corrispondent to the link
+		* @brief This function return a copy of the adjacency matrix with every element of the matrix
+		* contain the node where is directed the link and the Edge corrispondent to the link.
+		* The adjacency matrix is kept up to date by addEdge, removeEdge and setEdgeSet.
+		* Simple Edges ( neither Directed neither Undirected ) are not part of the adjacency matrix.
 		* Note: No Thread Safe
 		*/
 		virtual const AdjacencyMatrix<T> getAdjMatrix() const;
 		/**
+		* @brief This function return a reference to the maintained adjacency matrix, without copying it.
+		* The reference is valid until the Graph is modified or destroyed.
+		* Note: No Thread Safe, also on a Graph_TS the reference is read without the lock,
+		* use getAdjMatrix to get a copy taken under lock
+		*/
+		virtual const AdjacencyMatrix<T> &getAdjMatrixRef() const;
+		/**
+		* \brief
+		* Function that return an immutable CSR (Compressed Sparse Row) snapshot of the Graph.
+		* The snapshot is built once and cached until the Edge Set is modified, so repeated
+		* queries over a graph that rarely change do not pay the construction cost again.
+		* Note: No Thread Safe
+		*
+		* @returns the CSR snapshot of the graph
+		*/
+		virtual const std::shared_ptr<const CompactGraph<T, typename Policy::Weight>> freeze() const;
+		/**
+		* \brief
+		* Function that return an immutable compressed snapshot of the Graph, with the
+		* adjacency lists gap encoded with varints. It is cached like the CSR snapshot.
+		* Note: No Thread Safe
+		*
+		* @returns the compressed snapshot of the graph
+		*/
+		virtual const std::shared_ptr<const CompressedGraph<T, typename Policy::Weight>> freezeCompressed() const;
+		/**
+		* \brief
+		* Function that select the snapshot used by BFS, DFS and Dijkstra. With the compressed
+		* adjacency the links are decoded on the fly and visited in order of dense index of the
+		* destination, instead of the order of the Edge Set. The other algorithms use the CSR snapshot.
+		* Note: No Thread Safe
+		*
+		* @param compressed true to use the compressed snapshot
+		*/
+		virtual void setCompressedAdjacency(bool compressed);
+		/**
+		* \brief
+		* Function that return if BFS, DFS and Dijkstra use the compressed snapshot
+		* Note: No Thread Safe
+		*
+		* @returns true if the compressed snapshot is used
+		*/
+		virtual bool isCompressedAdjacency() const;
+		/**
+		* \brief
+		* Function that return an immutable Structure of Arrays snapshot of the Edge Set,
+		* with the ids, the Nodes, the weights and the flags of the Edges in separate columns.
+		* It is cached like the CSR snapshot.
+		* Note: No Thread Safe
+		*
+		* @returns the columns of the Edge Set
+		*/
+		virtual const std::shared_ptr<const EdgeColumns<T>> getEdgeColumns() const;
+		/**
+		* \brief
+		* Function that return an estimate of the memory used by the Graph, split by component.
+		* The Edge and Node objects are counted even if they are not owned by the Graph.
+		* Note: No Thread Safe
+		*
+		* @returns the memory usage in bytes
+		*/
+		virtual const MemoryUsage memoryUsage() const;
+		/**
+		* \brief
+		* Function that enable the tombstone removal mode. In this mode removeEdge does not
+		* invalidate the CSR snapshot: the links of the removed Edge are marked dead and skipped
+		* by the algorithms, until the number of dead links cross the compaction threshold.
+		* Note: No Thread Safe
+		*
+		* @param enabled true to enable the tombstone removal mode
+		*/
+		virtual void setTombstoneRemoval(bool enabled);
+		/**
+		* \brief
+		* Function that set the fraction of dead links over the links of the CSR snapshot
+		* that triggers its compaction
+		* Note: No Thread Safe
+		*
+		* @param threshold The compaction threshold, between 0 and 1
+		*/
+		virtual void setCompactionThreshold(double threshold);
+		/**
+		* \brief
+		* Function that return the number of dead links in the CSR snapshot
+		* Note: No Thread Safe
+		*
+		* @returns the number of tombstones
+		*/
+		virtual std::size_t getNumberOfTombstones() const;
+		/**
+		* \brief
+		* Function that return the number of links added after the CSR snapshot was built.
+		* The traversals read them next to the snapshot, the queries that read the CSR
+		* arrays directly fold them in, as does the compaction threshold.
+		* Note: No Thread Safe
+		*
+		* @returns the number of appended links
+		*/
+		virtual std::size_t getNumberOfAppendedLinks() const;
+		/**
+		* \brief
+		* Function that rebuild the CSR snapshot without the dead links and with the appended ones
+		* Note: No Thread Safe
+		*/
+		virtual void compact();
+		/**
  		* @brief Function runs the dijkstra algorithm for some source node and
  		* target node in the graph and returns the shortest distance of target
  		* from the source.
+		* The search stops as soon as the target is settled and the result contains
+		* also the shortest path.
 		* Note: No Thread Safe
  		*
 		* @param source source vertex
@@ -166,6 +626,67 @@ namespace CXXGRAPH
  		*/
 		virtual const DijkstraResult dijkstra(const Node<T> &source, const Node<T> &target) const;
 		/**
+ 		* @brief Function runs the dijkstra algorithm from a source node to all the
+ 		* nodes of the graph and returns the shortest distances in a flat array,
+		* together with the predecessors of every node on its shortest path.
+		* Note: No Thread Safe
+ 		*
+		* @param source source vertex
+ 		*
+ 		* @return the distances and the predecessors of all the nodes, or ERROR
+		* in case of error in the computation.
+ 		*/
+		virtual const DijkstraAllResult dijkstraAll(const Node<T> &source) const;
+		/**
+ 		* @brief Function runs the bidirectional dijkstra algorithm between a source node
+ 		* and a target node. A forward search from the source and a backward search from
+		* the target, over the reverse index of the Graph, are alternated and the search
+		* stops when their frontiers meet. On road-like graphs it settles far fewer nodes
+		* than dijkstra.
+		* Note: No Thread Safe
+ 		*
+		* @param source source vertex
+ 		* @param target target vertex
+ 		*
+ 		* @return shortest distance and path if target is reachable from source else ERROR in
+ 		* case if target is not reachable from source or there is error in the computation.
+ 		*/
+		virtual const DijkstraResult bidirectionalDijkstra(const Node<T> &source, const Node<T> &target) const;
+		/**
+ 		* @brief Function runs the A* algorithm between a source node and a target node.
+		* The nodes are settled in order of their distance from the source plus the heuristic
+		* estimate of their distance to the target, so the search is directed toward the target.
+		* The heuristic must be admissible, never greater than the real distance to the target,
+		* for the result to be the shortest path. A heuristic that is always 0 gives dijkstra.
+		* Note: Thread Safe when called on a Graph_TS, that hides it with a locked version
+ 		*
+		* @param source source vertex
+ 		* @param target target vertex
+		* @param heuristic The function called as heuristic(const Node<T> &node), returning the
+		* estimated distance from the node to the target
+ 		*
+ 		* @return shortest distance and path if target is reachable from source else ERROR in
+ 		* case if target is not reachable from source or there is error in the computation.
+ 		*/
+		template <typename Heuristic>
+		const DijkstraResult astar(const Node<T> &source, const Node<T> &target, Heuristic &&heuristic) const;
+		/**
+ 		* @brief Function runs the dijkstra algorithm from a batch of source nodes
+ 		* to a set of target nodes and returns the distance matrix. The traversal
+		* structure is built once and the sources are shared among a pool of threads,
+		* every thread reuses its own heap and distance array for all its sources.
+		* Every search stops as soon as all the targets are settled.
+		* Note: No Thread Safe
+ 		*
+		* @param sources source vertices
+		* @param targets target vertices
+		* @param numberOfThreads number of threads, 0 for the number of hardware threads
+ 		*
+ 		* @return the matrix of the distances of the targets from the sources, or ERROR
+		* in case of error in the computation.
+ 		*/
+		virtual const DijkstraBatchResult dijkstraBatch(const std::vector<const Node<T> *> &sources, const std::vector<const Node<T> *> &targets, unsigned int numberOfThreads = 0) const;
+		/**
  		* \brief
  		* Function performs the breadth first search algorithm over the graph
 		* Note: No Thread Safe
@@ -238,12 +759,43 @@ namespace CXXGRAPH
 		* Note: No Thread Safe
  		*
 		* @param source source vertex
-		* @param maxWeight maximum weight of the edge
+		* @param maxWeight maximum weight of the edge, the buckets are maxWeight + 1 used in circle
  		*
  		* @return shortest distance for all nodes reachable from source else ERROR in
- 		* case there is error in the computation.
+ 		* case there is error in the computation, or an edge weight is not in 0..maxWeight.
  		*/
 		virtual const DialResult dial(const Node<T> &source, int maxWeight) const;
+		/**
+ 		* @brief Function runs the parallel Delta-Stepping algorithm for some source node and
+ 		* returns the shortest distance of all the nodes from the source.
+		* The nodes are kept in buckets of width delta. The light edges, not heavier than delta,
+		* of the nodes in the current bucket are relaxed in parallel until the bucket stays empty,
+		* then the heavy edges of all the nodes removed from it are relaxed in parallel.
+		* A small delta does less wasted relaxations, a large one gives more parallel work per phase.
+		* Only the non-empty buckets are kept, so delta can be much smaller than the weights.
+		* Note: No Thread Safe
+ 		*
+		* @param source source vertex
+		* @param delta width of the buckets, a good start is the average weight of the edges
+		* @param numberOfThreads number of threads, 0 to use the hardware concurrency
+ 		*
+ 		* @return shortest distance for all nodes reachable from source else ERROR in
+ 		* case there is error in the computation, or an edge weight is negative or not a number.
+ 		*/
+		virtual const DeltaSteppingResult deltaStepping(const Node<T> &source, double delta, unsigned int numberOfThreads = 0) const;
+		/**
+ 		* @brief Function runs the dijkstra algorithm with a radix heap for some source node and
+ 		* returns the shortest distance of all the nodes from the source.
+		* The weights of the edges are read as non negative integers, like in dial, but there is
+		* no bound on them: the radix heap moves every node at most once per bit of its distance.
+		* Note: No Thread Safe
+ 		*
+		* @param source source vertex
+ 		*
+ 		* @return shortest distance for all nodes reachable from source else ERROR in
+ 		* case there is error in the computation, or an edge weight is negative.
+ 		*/
+		virtual const DialResult radixDijkstra(const Node<T> &source) const;
 
 		/**
      	* \brief
@@ -286,102 +838,562 @@ namespace CXXGRAPH
      	*/
 		virtual PartitionMap<T> partitionGraph(PARTITIONING::PartitionAlgorithm algorithm, unsigned int numberOfPartitions) const;
 
-		friend std::ostream &operator<<<>(std::ostream &os, const Graph<T> &graph);
+		friend std::ostream &operator<<<>(std::ostream &os, const Graph<T, Policy> &graph);
 		friend std::ostream &operator<<<>(std::ostream &os, const AdjacencyMatrix<T> &adj);
 	};
 
-	template <typename T>
-	Graph<T>::Graph(const std::list<const Edge<T> *> &edgeSet)
+	template <typename T, typename Policy>
+	Graph<T, Policy>::Graph(const std::list<const Edge<T> *> &edgeSet)
 	{
-		for (auto edgeSetIt = edgeSet.begin(); edgeSetIt != edgeSet.end(); ++edgeSetIt)
+		edgeIndex.reserve(edgeSet.size());
+		pairIndex.reserve(edgeSet.size());
+		for (auto edge : edgeSet)
+		{
+			insertEdge(edge);
+		}
+	}
+
+	template <typename T, typename Policy>
+	Graph<T, Policy>::Graph(std::list<const Edge<T> *> &&edgeSet) : edgeSet(std::move(edgeSet))
+	{
+		// index the Edges in place, the rejected ones are unlinked from the list
+		edgeIndex.reserve(this->edgeSet.size());
+		pairIndex.reserve(this->edgeSet.size());
+		for (auto edgeSetIt = this->edgeSet.begin(); edgeSetIt != this->edgeSet.end();)
 		{
-			if (std::find_if(this->edgeSet.begin(), this->edgeSet.end(), [edgeSetIt](const Edge<T> *edge)
-							 { return (*edge == **edgeSetIt); }) == this->edgeSet.end())
+			if (!acceptsEdge(*edgeSetIt) || findEdge(*edgeSetIt) != this->edgeSet.end())
+			{
+				edgeSetIt = this->edgeSet.erase(edgeSetIt);
+			}
+			else
 			{
-				this->edgeSet.push_back(*edgeSetIt);
+				indexEdge(edgeSetIt++);
 			}
 		}
 	}
 
-	template <typename T>
-	const std::list<const Edge<T> *> &Graph<T>::getEdgeSet() const
+	template <typename T, typename Policy>
+	Graph<T, Policy>::Graph(const Graph<T, Policy> &graph) : edgeSet(graph.edgeSet), compactGraph(graph.compactGraph), compressedAdjacency(graph.compressedAdjacency), compressedGraph(graph.compressedGraph), edgeColumns(graph.edgeColumns), tombstoneRemoval(graph.tombstoneRemoval), compactionThreshold(graph.compactionThreshold), tombstones(graph.tombstones), numberOfTombstones(graph.numberOfTombstones), appended(graph.appended)
 	{
-		return edgeSet;
+		inheritArenas(graph);
+		indexEdgeSet();
 	}
 
-	template <typename T>
-	void Graph<T>::setEdgeSet(std::list<const Edge<T> *> &edgeSet)
+	template <typename T, typename Policy>
+	Graph<T, Policy> &Graph<T, Policy>::operator=(const Graph<T, Policy> &graph)
 	{
-		this->edgeSet.clear();
-		for (auto edgeSetIt = edgeSet.begin(); edgeSetIt != edgeSet.end(); ++edgeSetIt)
+		if (this != &graph)
+		{
+			edgeSet = graph.edgeSet;
+			compactGraph = graph.compactGraph;
+			compressedAdjacency = graph.compressedAdjacency;
+			compressedGraph = graph.compressedGraph;
+			edgeColumns = graph.edgeColumns;
+			tombstoneRemoval = graph.tombstoneRemoval;
+			compactionThreshold = graph.compactionThreshold;
+			tombstones = graph.tombstones;
+			numberOfTombstones = graph.numberOfTombstones;
+			appended = graph.appended;
+			// the previous arena is kept alive by the copies that still refer to its objects
+			inheritArenas(graph);
+			arena.reset();
+			edgeIndex.clear();
+			pairIndex.clear();
+			nodeSet.clear();
+			nodeRegistry.clear();
+			adjMatrix.clear();
+			indexEdgeSet();
+		}
+		return *this;
+	}
+
+	template <typename T, typename Policy>
+	Graph<T, Policy>::Graph(Graph<T, Policy> &&graph) noexcept : edgeSet(std::move(graph.edgeSet)), edgeIndex(std::move(graph.edgeIndex)), pairIndex(std::move(graph.pairIndex)), nodeSet(std::move(graph.nodeSet)), nodeRegistry(std::move(graph.nodeRegistry)), adjMatrix(std::move(graph.adjMatrix)), compactGraph(std::move(graph.compactGraph)), compressedAdjacency(graph.compressedAdjacency), compressedGraph(std::move(graph.compressedGraph)), edgeColumns(std::move(graph.edgeColumns)), tombstoneRemoval(graph.tombstoneRemoval), compactionThreshold(graph.compactionThreshold), tombstones(std::move(graph.tombstones)), numberOfTombstones(graph.numberOfTombstones), appended(std::move(graph.appended)), arena(std::move(graph.arena)), inheritedArenas(std::move(graph.inheritedArenas))
+	{
+		// the list nodes are transferred, so the iterators stored in the indexes are still valid
+		graph.clearMovedFrom();
+	}
+
+	template <typename T, typename Policy>
+	Graph<T, Policy> &Graph<T, Policy>::operator=(Graph<T, Policy> &&graph) noexcept
+	{
+		if (this != &graph)
+		{
+			edgeSet = std::move(graph.edgeSet);
+			edgeIndex = std::move(graph.edgeIndex);
+			pairIndex = std::move(graph.pairIndex);
+			nodeSet = std::move(graph.nodeSet);
+			nodeRegistry = std::move(graph.nodeRegistry);
+			adjMatrix = std::move(graph.adjMatrix);
+			compactGraph = std::move(graph.compactGraph);
+			compressedAdjacency = graph.compressedAdjacency;
+			compressedGraph = std::move(graph.compressedGraph);
+			edgeColumns = std::move(graph.edgeColumns);
+			tombstoneRemoval = graph.tombstoneRemoval;
+			compactionThreshold = graph.compactionThreshold;
+			tombstones = std::move(graph.tombstones);
+			numberOfTombstones = graph.numberOfTombstones;
+			appended = std::move(graph.appended);
+			arena = std::move(graph.arena);
+			inheritedArenas = std::move(graph.inheritedArenas);
+			graph.clearMovedFrom();
+		}
+		return *this;
+	}
+
+	template <typename T, typename Policy>
+	void Graph<T, Policy>::clearMovedFrom() noexcept
+	{
+		// the moved containers are valid but unspecified, leave an empty Graph behind
+		edgeSet.clear();
+		edgeIndex.clear();
+		pairIndex.clear();
+		nodeSet.clear();
+		nodeRegistry.clear();
+		adjMatrix.clear();
+		compactGraph.reset();
+		compressedGraph.reset();
+		edgeColumns.reset();
+		tombstones.clear();
+		numberOfTombstones = 0;
+		appended = AppendedLinks();
+		arena.reset();
+		inheritedArenas.clear();
+	}
+
+	template <typename T, typename Policy>
+	typename std::list<const Edge<T> *>::iterator Graph<T, Policy>::findEdge(const Edge<T> *edge)
+	{
+		// equal Edges share the same id, so only the bucket of the id must be checked
+		auto range = edgeIndex.equal_range(edge->getId());
+		for (auto it = range.first; it != range.second; ++it)
 		{
-			if (std::find_if(this->edgeSet.begin(), this->edgeSet.end(), [edgeSetIt](const Edge<T> *edge)
-							 { return (*edge == **edgeSetIt); }) == this->edgeSet.end())
+			if (**(it->second) == *edge)
 			{
-				this->edgeSet.push_back(*edgeSetIt);
+				return it->second;
 			}
 		}
+		return edgeSet.end();
 	}
 
-	template <typename T>
-	void Graph<T>::addEdge(const Edge<T> *edge)
+	template <typename T, typename Policy>
+	bool Graph<T, Policy>::insertEdge(const Edge<T> *edge)
 	{
-		if (std::find_if(edgeSet.begin(), edgeSet.end(), [edge](const Edge<T> *edge_a)
-						 { return (*edge == *edge_a); }) == edgeSet.end())
+		if (!acceptsEdge(edge) || findEdge(edge) != edgeSet.end())
 		{
-			edgeSet.push_back(edge);
+			return false;
 		}
+		indexEdge(edgeSet.insert(edgeSet.end(), edge));
+		return true;
 	}
 
-	template <typename T>
-	void Graph<T>::removeEdge(unsigned long edgeId)
+	template <typename T, typename Policy>
+	void Graph<T, Policy>::indexEdge(typename std::list<const Edge<T> *>::iterator edgeSetIt)
 	{
-		auto edgeOpt = Graph<T>::getEdge(edgeId);
-		if (edgeOpt.has_value())
+		const Edge<T> *edge = *edgeSetIt;
+		edgeIndex.emplace(edge->getId(), edgeSetIt);
+		indexNodePair(edge);
+		registerNode(edge->getNodePair().first);
+		registerNode(edge->getNodePair().second);
+		if constexpr (Policy::kind == GraphKind::DIRECTED_GRAPH)
 		{
-			edgeSet.erase(std::find_if(this->edgeSet.begin(), this->edgeSet.end(), [edgeOpt](const Edge<T> *edge)
-									   { return (*(edgeOpt.value()) == *edge); }));
+			addElementToAdjMatrix(adjMatrix, edge->getNodePair().first, edge->getNodePair().second, edge);
 		}
-	}
-
-	template <typename T>
-	const std::list<const Node<T> *> Graph<T>::getNodeSet() const
-	{
-		std::list<const Node<T> *> nodeSet;
-		for (auto edge : edgeSet)
+		else if constexpr (Policy::kind == GraphKind::UNDIRECTED_GRAPH)
 		{
-			if (std::find_if(nodeSet.begin(), nodeSet.end(), [edge](const Node<T> *node)
-							 { return (*edge->getNodePair().first == *node); }) == nodeSet.end())
-			{
-				nodeSet.push_back(edge->getNodePair().first);
-			}
-			if (std::find_if(nodeSet.begin(), nodeSet.end(), [edge](const Node<T> *node)
-							 { return (*edge->getNodePair().second == *node); }) == nodeSet.end())
+			addElementToAdjMatrix(adjMatrix, edge->getNodePair().first, edge->getNodePair().second, edge);
+			addElementToAdjMatrix(adjMatrix, edge->getNodePair().second, edge->getNodePair().first, edge);
+		}
+		else if (edge->isDirected().has_value())
+		{
+			addElementToAdjMatrix(adjMatrix, edge->getNodePair().first, edge->getNodePair().second, edge);
+			if (!edge->isDirected().value())
 			{
-				nodeSet.push_back(edge->getNodePair().second);
+				addElementToAdjMatrix(adjMatrix, edge->getNodePair().second, edge->getNodePair().first, edge);
 			}
 		}
-		return nodeSet;
 	}
 
-	template <typename T>
-	const std::optional<const Edge<T> *> Graph<T>::getEdge(unsigned long edgeId) const
+	template <typename T, typename Policy>
+	template <typename Function>
+	void Graph<T, Policy>::forEachLinkKey(const Edge<T> *edge, Function &&function) const
 	{
-
-		auto it = edgeSet.begin();
-		for (it; it != edgeSet.end(); ++it)
+		// the same links of the adjacency matrix: none for a simple Edge, two for an Undirected one
+		std::pair<unsigned long, unsigned long> key(edge->getNodePair().first->getId(), edge->getNodePair().second->getId());
+		bool directed;
+		if constexpr (Policy::kind == GraphKind::DIRECTED_GRAPH)
 		{
-			if ((*it)->getId() == edgeId)
-			{
-				return *it;
+			directed = true;
+		}
+		else if constexpr (Policy::kind == GraphKind::UNDIRECTED_GRAPH)
+		{
+			directed = false;
+		}
+		else
+		{
+			if (!edge->isDirected().has_value())
+			{
+				return;
+			}
+			directed = edge->isDirected().value();
+		}
+		function(key);
+		if (!directed && key.first != key.second)
+		{
+			function(std::make_pair(key.second, key.first));
+		}
+	}
+
+	template <typename T, typename Policy>
+	void Graph<T, Policy>::indexNodePair(const Edge<T> *edge)
+	{
+		forEachLinkKey(edge, [this, edge](const std::pair<unsigned long, unsigned long> &key)
+					   { pairIndex.emplace(key, edge); });
+	}
+
+	template <typename T, typename Policy>
+	void Graph<T, Policy>::unindexNodePair(const Edge<T> *edge)
+	{
+		forEachLinkKey(edge, [this, edge](const std::pair<unsigned long, unsigned long> &key)
+					   {
+						   auto range = pairIndex.equal_range(key);
+						   for (auto it = range.first; it != range.second; ++it)
+						   {
+							   if (it->second == edge)
+							   {
+								   pairIndex.erase(it);
+								   break;
+							   }
+						   } });
+	}
+
+	template <typename T, typename Policy>
+	bool Graph<T, Policy>::linksNodes(const Edge<T> *edge, const Node<T> &nodeFrom, const Node<T> &nodeTo)
+	{
+		// the ids already match the key of the Node Pair Index, the Nodes must also be equal
+		const auto &nodePair = edge->getNodePair();
+		const Node<T> *source = nodePair.first->getId() == nodeFrom.getId() ? nodePair.first : nodePair.second;
+		const Node<T> *target = source == nodePair.first ? nodePair.second : nodePair.first;
+		return *source == nodeFrom && *target == nodeTo;
+	}
+
+	template <typename T, typename Policy>
+	bool Graph<T, Policy>::acceptsEdge(const Edge<T> *edge)
+	{
+		if constexpr (Policy::kind == GraphKind::DIRECTED_GRAPH)
+		{
+			if (!(edge->isDirected().has_value() && edge->isDirected().value()))
+			{
+				return false;
+			}
+		}
+		else if constexpr (Policy::kind == GraphKind::UNDIRECTED_GRAPH)
+		{
+			if (!(edge->isDirected().has_value() && !edge->isDirected().value()))
+			{
+				return false;
+			}
+		}
+		if constexpr (Policy::allWeighted)
+		{
+			if (!(edge->isWeighted().has_value() && edge->isWeighted().value()))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	template <typename T, typename Policy>
+	void Graph<T, Policy>::registerNode(const Node<T> *node)
+	{
+		// Nodes are identified by their id, every endpoint of an Edge add a reference
+		auto it = nodeRegistry.find(node->getId());
+		if (it != nodeRegistry.end())
+		{
+			it->second.second++;
+		}
+		else
+		{
+			nodeRegistry.emplace(node->getId(), std::make_pair(nodeSet.insert(nodeSet.end(), node), 1ul));
+		}
+	}
+
+	template <typename T, typename Policy>
+	void Graph<T, Policy>::unregisterNode(const Node<T> *node)
+	{
+		auto it = nodeRegistry.find(node->getId());
+		if (it != nodeRegistry.end() && --(it->second.second) == 0)
+		{
+			// the last Edge of the Node has been removed
+			nodeSet.erase(it->second.first);
+			nodeRegistry.erase(it);
+		}
+	}
+
+	template <typename T, typename Policy>
+	const std::list<const Edge<T> *> Graph<T, Policy>::getEdgeSet() const
+	{
+		return edgeSet;
+	}
+
+	template <typename T, typename Policy>
+	void Graph<T, Policy>::setEdgeSet(std::list<const Edge<T> *> &edgeSet)
+	{
+		this->edgeSet.clear();
+		edgeIndex.clear();
+		pairIndex.clear();
+		nodeSet.clear();
+		nodeRegistry.clear();
+		adjMatrix.clear();
+		resetSnapshots();
+		edgeIndex.reserve(edgeSet.size());
+		pairIndex.reserve(edgeSet.size());
+		for (auto edge : edgeSet)
+		{
+			insertEdge(edge);
+		}
+	}
+
+	template <typename T, typename Policy>
+	void Graph<T, Policy>::addEdge(const Edge<T> *edge)
+	{
+		if (insertEdge(edge))
+		{
+			appendToSnapshots(edge);
+		}
+	}
+
+	template <typename T, typename Policy>
+	const Edge<T> *Graph<T, Policy>::addEdge(std::unique_ptr<const Edge<T>> edge)
+	{
+		if (!edge || !acceptsEdge(edge.get()) || findEdge(edge.get()) != edgeSet.end())
+		{
+			return nullptr;
+		}
+		// the Arena take the ownership before the Edge is published in the Edge Set
+		Arena &graphArena = getArena();
+		const Edge<T> *owned = graphArena.adopt(std::move(edge));
+		insertEdge(owned);
+		appendToSnapshots(owned);
+		return owned;
+	}
+
+	template <typename T, typename Policy>
+	const Node<T> *Graph<T, Policy>::createNode(unsigned long id, const T &data)
+	{
+		Arena &graphArena = getArena();
+		return graphArena.create<Node<T>>(id, data);
+	}
+
+	template <typename T, typename Policy>
+	void Graph<T, Policy>::insertEdges(const std::vector<const Edge<T> *> &edges)
+	{
+		edgeIndex.reserve(edgeIndex.size() + edges.size());
+		pairIndex.reserve(pairIndex.size() + edges.size());
+		for (auto edge : edges)
+		{
+			// the edges of the batch are indexed as soon as they are inserted,
+			// so duplicates inside the batch are found by the same lookup
+			if (insertEdge(edge))
+			{
+				appendToSnapshots(edge);
+			}
+		}
+	}
+
+	template <typename T, typename Policy>
+	void Graph<T, Policy>::addEdges(const std::vector<const Edge<T> *> &edges)
+	{
+		insertEdges(edges);
+	}
+
+	template <typename T, typename Policy>
+	template <typename InputIt>
+	void Graph<T, Policy>::addEdges(InputIt begin, InputIt end)
+	{
+		// collect the range and publish it with the virtual overload, so Graph_TS locks once per batch
+		addEdges(std::vector<const Edge<T> *>(begin, end));
+	}
+
+	template <typename T, typename Policy>
+	void Graph<T, Policy>::removeEdge(unsigned long edgeId)
+	{
+		auto it = edgeIndex.find(edgeId);
+		if (it != edgeIndex.end())
+		{
+			const Edge<T> *edge = *(it->second);
+			if constexpr (Policy::kind == GraphKind::DIRECTED_GRAPH)
+			{
+				removeElementFromAdjMatrix(adjMatrix, edge->getNodePair().first, edge);
+			}
+			else if constexpr (Policy::kind == GraphKind::UNDIRECTED_GRAPH)
+			{
+				removeElementFromAdjMatrix(adjMatrix, edge->getNodePair().first, edge);
+				removeElementFromAdjMatrix(adjMatrix, edge->getNodePair().second, edge);
 			}
+			else if (edge->isDirected().has_value())
+			{
+				removeElementFromAdjMatrix(adjMatrix, edge->getNodePair().first, edge);
+				if (!edge->isDirected().value())
+				{
+					removeElementFromAdjMatrix(adjMatrix, edge->getNodePair().second, edge);
+				}
+			}
+			unindexNodePair(edge);
+			unregisterNode(edge->getNodePair().first);
+			unregisterNode(edge->getNodePair().second);
+			edgeSet.erase(it->second);
+			edgeIndex.erase(it);
+			if (tombstoneRemoval && compactGraph)
+			{
+				markTombstones(edge);
+			}
+			else
+			{
+				resetSnapshots();
+			}
+		}
+	}
+
+	template <typename T, typename Policy>
+	const std::list<const Node<T> *> Graph<T, Policy>::getNodeSet() const
+	{
+		return nodeSet;
+	}
+
+	template <typename T, typename Policy>
+	const std::optional<const Node<T> *> Graph<T, Policy>::getNode(unsigned long nodeId) const
+	{
+		auto it = nodeRegistry.find(nodeId);
+		if (it != nodeRegistry.end())
+		{
+			return *(it->second.first);
 		}
 
 		return std::nullopt;
 	}
 
-	template <typename T>
-	void Graph<T>::addElementToAdjMatrix(AdjacencyMatrix<T> &adjMatrix, const Node<T> *nodeFrom, const Node<T> *nodeTo, const Edge<T> *edge) const
+	template <typename T, typename Policy>
+	std::size_t Graph<T, Policy>::getInDegree(const Node<T> &node) const
+	{
+		auto compact = getCompactGraph();
+		auto index = getLiveIndex(*compact, node);
+		if (!index.has_value())
+		{
+			return 0;
+		}
+		std::size_t inDegree = compact->getInDegree(index.value());
+		if (numberOfTombstones)
+		{
+			compact->forEachInLink(index.value(), [this, &inDegree](std::size_t link, const auto &)
+								   { inDegree -= isTombstone(link); });
+		}
+		return inDegree;
+	}
+
+	template <typename T, typename Policy>
+	const std::vector<const Node<T> *> Graph<T, Policy>::getPredecessors(const Node<T> &node) const
+	{
+		std::vector<const Node<T> *> predecessors;
+		auto compact = getCompactGraph();
+		auto index = getLiveIndex(*compact, node);
+		if (index.has_value())
+		{
+			predecessors.reserve(compact->getInDegree(index.value()));
+			compact->forEachInLink(index.value(), [this, &compact, &predecessors](std::size_t link, const auto &record)
+								   {
+									   if (!isTombstone(link))
+									   {
+										   predecessors.push_back(compact->getNode(record.from));
+									   } });
+		}
+		return predecessors;
+	}
+
+	template <typename T, typename Policy>
+	bool Graph<T, Policy>::hasEdge(const Node<T> &nodeFrom, const Node<T> &nodeTo) const
+	{
+		auto range = pairIndex.equal_range(std::make_pair(nodeFrom.getId(), nodeTo.getId()));
+		for (auto it = range.first; it != range.second; ++it)
+		{
+			if (linksNodes(it->second, nodeFrom, nodeTo))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	template <typename T, typename Policy>
+	const std::vector<const Edge<T> *> Graph<T, Policy>::getEdgesBetween(const Node<T> &nodeFrom, const Node<T> &nodeTo) const
+	{
+		std::vector<const Edge<T> *> edges;
+		auto range = pairIndex.equal_range(std::make_pair(nodeFrom.getId(), nodeTo.getId()));
+		for (auto it = range.first; it != range.second; ++it)
+		{
+			if (linksNodes(it->second, nodeFrom, nodeTo))
+			{
+				edges.push_back(it->second);
+			}
+		}
+		return edges;
+	}
+
+	template <typename T, typename Policy>
+	template <typename Function>
+	void Graph<T, Policy>::forEachNeighbor(const Node<T> &node, Function &&function) const
+	{
+		// neighbors is virtual, so Graph_TS takes the range under lock and the iteration runs without it
+		for (const auto &neighbor : neighbors(node))
+		{
+			function(neighbor.node, neighbor.edge, neighbor.weight);
+		}
+	}
+
+	template <typename T, typename Policy>
+	NeighborRange<T, typename Policy::Weight> Graph<T, Policy>::neighbors(const Node<T> &node) const
+	{
+		// the dead links are skipped, a query must not rebuild the CSR in tombstone mode,
+		// only the appended links are folded in since the range reads the CSR arrays
+		auto compact = getCompactGraph();
+		auto index = getLiveIndex(*compact, node);
+		if (!index.has_value())
+		{
+			return NeighborRange<T, typename Policy::Weight>();
+		}
+		auto first = compact->getOffsets()[index.value()];
+		auto last = compact->getOffsets()[index.value() + 1];
+		if (!numberOfTombstones)
+		{
+			return NeighborRange<T, typename Policy::Weight>(std::move(compact), first, last);
+		}
+		std::vector<std::size_t> links;
+		links.reserve(last - first);
+		for (auto link = first; link < last; ++link)
+		{
+			if (!tombstones[link])
+			{
+				links.push_back(link);
+			}
+		}
+		return NeighborRange<T, typename Policy::Weight>(std::move(compact), std::move(links));
+	}
+
+	template <typename T, typename Policy>
+	const std::optional<const Edge<T> *> Graph<T, Policy>::getEdge(unsigned long edgeId) const
+	{
+		auto it = edgeIndex.find(edgeId);
+		if (it != edgeIndex.end())
+		{
+			return *(it->second);
+		}
+
+		return std::nullopt;
+	}
+
+	template <typename T, typename Policy>
+	void Graph<T, Policy>::addElementToAdjMatrix(AdjacencyMatrix<T> &adjMatrix, const Node<T> *nodeFrom, const Node<T> *nodeTo, const Edge<T> *edge) const
 	{
 		std::pair<const Node<T> *, const Edge<T> *> elem = {nodeTo, edge};
 		adjMatrix[nodeFrom].push_back(elem);
@@ -389,8 +1401,29 @@ namespace CXXGRAPH
 		//adjMatrix[nodeFrom.getId()].push_back(std::make_pair<const Node<T>,const Edge<T>>(nodeTo, edge));
 	}
 
-	template <typename T>
-	int Graph<T>::writeToStandardFile_csv(const std::string &workingDir, const std::string &OFileName, bool compress, bool writeNodeFeat, bool writeEdgeWeight) const
+	template <typename T, typename Policy>
+	void Graph<T, Policy>::removeElementFromAdjMatrix(AdjacencyMatrix<T> &adjMatrix, const Node<T> *nodeFrom, const Edge<T> *edge) const
+	{
+		auto it = adjMatrix.find(nodeFrom);
+		if (it == adjMatrix.end())
+		{
+			return;
+		}
+		auto elemIt = std::find_if(it->second.begin(), it->second.end(), [edge](const std::pair<const Node<T> *, const Edge<T> *> &elem)
+								   { return elem.second == edge; });
+		if (elemIt != it->second.end())
+		{
+			it->second.erase(elemIt);
+		}
+		if (it->second.empty())
+		{
+			// a node without outgoing links is not part of the adjacency matrix
+			adjMatrix.erase(it);
+		}
+	}
+
+	template <typename T, typename Policy>
+	int Graph<T, Policy>::writeToStandardFile_csv(const std::string &workingDir, const std::string &OFileName, bool compress, bool writeNodeFeat, bool writeEdgeWeight) const
 	{
 		std::ofstream ofileGraph;
 		std::string completePathToFileGraph = workingDir + "/" + OFileName + ".csv";
@@ -400,9 +1433,13 @@ namespace CXXGRAPH
 			// ERROR File Not Open
 			return -1;
 		}
-		auto printOutGraph = [&ofileGraph](const Edge<T> *e)
-		{ ofileGraph << e->getId() << "," << e->getNodePair().first->getId() << "," << e->getNodePair().second->getId() << "," << ((e->isDirected().has_value() && e->isDirected().value()) ? 1 : 0) << std::endl; };
-		std::for_each(edgeSet.cbegin(), edgeSet.cend(), printOutGraph);
+		// the Edges are exported from the columns of the Edge Set, without calling the Edge objects
+		auto columns = getColumns();
+		const auto &nodeIndex = columns->getNodeIndex();
+		for (std::size_t i = 0; i < columns->size(); ++i)
+		{
+			ofileGraph << columns->getIds()[i] << "," << nodeIndex.getNode(columns->getSources()[i])->getId() << "," << nodeIndex.getNode(columns->getTargets()[i])->getId() << "," << static_cast<int>(columns->getDirected()[i]) << "\n";
+		}
 		ofileGraph.close();
 
 		if (writeNodeFeat)
@@ -418,7 +1455,6 @@ namespace CXXGRAPH
 			}
 			auto printOutNodeFeat = [&ofileNodeFeat](const Node<T> *node)
 			{ ofileNodeFeat << node->getId() << "," << node->getData() << std::endl; };
-			auto nodeSet = getNodeSet();
 			std::for_each(nodeSet.cbegin(), nodeSet.cend(), printOutNodeFeat);
 			ofileNodeFeat.close();
 		}
@@ -434,17 +1470,17 @@ namespace CXXGRAPH
 				// ERROR File Not Open
 				return -1;
 			}
-			auto printOutEdgeWeight = [&ofileEdgeWeight](const Edge<T> *e)
-			{ ofileEdgeWeight << e->getId() << "," << (e->isWeighted().has_value() && e->isWeighted().value() ? (dynamic_cast<const Weighted *>(e))->getWeight() : 0.0) << "," << (e->isWeighted().has_value() && e->isWeighted().value() ? 1 : 0) << std::endl; };
-
-			std::for_each(edgeSet.cbegin(), edgeSet.cend(), printOutEdgeWeight);
+			for (std::size_t i = 0; i < columns->size(); ++i)
+			{
+				ofileEdgeWeight << columns->getIds()[i] << "," << columns->getWeights()[i] << "," << static_cast<int>(columns->getWeighted()[i]) << "\n";
+			}
 			ofileEdgeWeight.close();
 		}
 		return 0;
 	}
 
-	template <typename T>
-	int Graph<T>::readFromStandardFile_csv(const std::string &workingDir, const std::string &OFileName, bool compress, bool readNodeFeat, bool readEdgeWeight)
+	template <typename T, typename Policy>
+	int Graph<T, Policy>::readFromStandardFile_csv(const std::string &workingDir, const std::string &OFileName, bool compress, bool readNodeFeat, bool readEdgeWeight)
 	{
 		std::ifstream ifileGraph;
 		std::ifstream ifileNodeFeat;
@@ -529,8 +1565,8 @@ namespace CXXGRAPH
 		return 0;
 	}
 
-	template <typename T>
-	int Graph<T>::writeToStandardFile_tsv(const std::string &workingDir, const std::string &OFileName, bool compress, bool writeNodeFeat, bool writeEdgeWeight) const
+	template <typename T, typename Policy>
+	int Graph<T, Policy>::writeToStandardFile_tsv(const std::string &workingDir, const std::string &OFileName, bool compress, bool writeNodeFeat, bool writeEdgeWeight) const
 	{
 		std::ofstream ofileGraph;
 		std::string completePathToFileGraph = workingDir + "/" + OFileName + ".tsv";
@@ -540,9 +1576,13 @@ namespace CXXGRAPH
 			// ERROR File Not Open
 			return -1;
 		}
-		auto printOutGraph = [&ofileGraph](const Edge<T> *e)
-		{ ofileGraph << e->getId() << "\t" << e->getNodePair().first->getId() << "\t" << e->getNodePair().second->getId() << "\t" << ((e->isDirected().has_value() && e->isDirected().value()) ? 1 : 0) << std::endl; };
-		std::for_each(edgeSet.cbegin(), edgeSet.cend(), printOutGraph);
+		// the Edges are exported from the columns of the Edge Set, without calling the Edge objects
+		auto columns = getColumns();
+		const auto &nodeIndex = columns->getNodeIndex();
+		for (std::size_t i = 0; i < columns->size(); ++i)
+		{
+			ofileGraph << columns->getIds()[i] << "\t" << nodeIndex.getNode(columns->getSources()[i])->getId() << "\t" << nodeIndex.getNode(columns->getTargets()[i])->getId() << "\t" << static_cast<int>(columns->getDirected()[i]) << "\n";
+		}
 		ofileGraph.close();
 
 		if (writeNodeFeat)
@@ -558,7 +1598,6 @@ namespace CXXGRAPH
 			}
 			auto printOutNodeFeat = [&ofileNodeFeat](const Node<T> *node)
 			{ ofileNodeFeat << node->getId() << "\t" << node->getData() << std::endl; };
-			auto nodeSet = getNodeSet();
 			std::for_each(nodeSet.cbegin(), nodeSet.cend(), printOutNodeFeat);
 			ofileNodeFeat.close();
 		}
@@ -574,17 +1613,17 @@ namespace CXXGRAPH
 				// ERROR File Not Open
 				return -1;
 			}
-			auto printOutEdgeWeight = [&ofileEdgeWeight](const Edge<T> *e)
-			{ ofileEdgeWeight << e->getId() << "\t" << (e->isWeighted().has_value() && e->isWeighted().value() ? (dynamic_cast<const Weighted *>(e))->getWeight() : 0.0) << "\t" << (e->isWeighted().has_value() && e->isWeighted().value() ? 1 : 0) << std::endl; };
-
-			std::for_each(edgeSet.cbegin(), edgeSet.cend(), printOutEdgeWeight);
+			for (std::size_t i = 0; i < columns->size(); ++i)
+			{
+				ofileEdgeWeight << columns->getIds()[i] << "\t" << columns->getWeights()[i] << "\t" << static_cast<int>(columns->getWeighted()[i]) << "\n";
+			}
 			ofileEdgeWeight.close();
 		}
 		return 0;
 	}
 
-	template <typename T>
-	int Graph<T>::readFromStandardFile_tsv(const std::string &workingDir, const std::string &OFileName, bool compress, bool readNodeFeat, bool readEdgeWeight)
+	template <typename T, typename Policy>
+	int Graph<T, Policy>::readFromStandardFile_tsv(const std::string &workingDir, const std::string &OFileName, bool compress, bool readNodeFeat, bool readEdgeWeight)
 	{
 		std::ifstream ifileGraph;
 		std::ifstream ifileNodeFeat;
@@ -668,10 +1707,67 @@ namespace CXXGRAPH
 		return 0;
 	}
 
-	template <typename T>
-	void Graph<T>::recreateGraphFromReadFiles(std::map<unsigned long, std::pair<unsigned long, unsigned long>> &edgeMap, std::map<unsigned long, bool> &edgeDirectedMap, std::map<unsigned long, T> &nodeFeatMap, std::map<unsigned long, double> &edgeWeightMap)
+	template <typename T, typename Policy>
+	Arena &Graph<T, Policy>::getArena()
+	{
+		if (!arena)
+		{
+			arena = std::make_shared<Arena>();
+		}
+		return *arena;
+	}
+
+	template <typename T, typename Policy>
+	void Graph<T, Policy>::copyEdgeSet(const Graph<T, Policy> &graph)
+	{
+		edgeSet = graph.edgeSet;
+		// the CSR snapshot with dead or appended links is rebuilt by the copy, so they are not copied
+		compactGraph = graph.isSnapshotPatched() ? nullptr : graph.compactGraph;
+		compressedAdjacency = graph.compressedAdjacency;
+		compressedGraph = graph.compressedGraph;
+		edgeColumns = graph.edgeColumns;
+		tombstoneRemoval = graph.tombstoneRemoval;
+		compactionThreshold = graph.compactionThreshold;
+		tombstones.clear();
+		numberOfTombstones = 0;
+		appended = AppendedLinks();
+		inheritArenas(graph);
+	}
+
+	template <typename T, typename Policy>
+	void Graph<T, Policy>::indexEdgeSet()
+	{
+		// the indexes store iterators, so they must point to the copied lists
+		edgeIndex.reserve(edgeSet.size());
+		pairIndex.reserve(edgeSet.size());
+		for (auto edgeSetIt = edgeSet.begin(); edgeSetIt != edgeSet.end(); ++edgeSetIt)
+		{
+			indexEdge(edgeSetIt);
+		}
+	}
+
+	template <typename T, typename Policy>
+	void Graph<T, Policy>::inheritArenas(const Graph<T, Policy> &graph)
+	{
+		// a copy never shares a mutable arena: two copies used by different threads
+		// would allocate from it at the same time
+		auto arenas = graph.inheritedArenas;
+		if (graph.arena)
+		{
+			arenas.push_back(graph.arena);
+		}
+		inheritedArenas = std::move(arenas);
+	}
+
+	template <typename T, typename Policy>
+	void Graph<T, Policy>::recreateGraphFromReadFiles(std::map<unsigned long, std::pair<unsigned long, unsigned long>> &edgeMap, std::map<unsigned long, bool> &edgeDirectedMap, std::map<unsigned long, T> &nodeFeatMap, std::map<unsigned long, double> &edgeWeightMap)
 	{
-		std::map<unsigned long, Node<T> *> nodeMap;
+		// Nodes and Edges are allocated in the arena of the Graph and released with it
+		Arena &graphArena = getArena();
+		std::unordered_map<unsigned long, Node<T> *> nodeMap;
+		nodeMap.reserve(2 * edgeMap.size());
+		std::vector<const Edge<T> *> edges;
+		edges.reserve(edgeMap.size());
 		for (auto edgeIt = edgeMap.begin(); edgeIt != edgeMap.end(); ++edgeIt)
 		{
 			Node<T> *node1 = nullptr;
@@ -684,7 +1780,7 @@ namespace CXXGRAPH
 				{
 					feat = nodeFeatMap.at(edgeIt->second.first);
 				}
-				node1 = new Node<T>(edgeIt->second.first, feat);
+				node1 = graphArena.create<Node<T>>(edgeIt->second.first, feat);
 				nodeMap[edgeIt->second.first] = node1;
 			}
 			else
@@ -699,7 +1795,7 @@ namespace CXXGRAPH
 				{
 					feat = nodeFeatMap.at(edgeIt->second.second);
 				}
-				node2 = new Node<T>(edgeIt->second.second, feat);
+				node2 = graphArena.create<Node<T>>(edgeIt->second.second, feat);
 				nodeMap[edgeIt->second.second] = node2;
 			}
 			else
@@ -711,33 +1807,34 @@ namespace CXXGRAPH
 			{
 				if (edgeDirectedMap.find(edgeIt->first) != edgeDirectedMap.end() && edgeDirectedMap.at(edgeIt->first))
 				{
-					auto edge = new DirectedWeightedEdge<T>(edgeIt->first, *node1, *node2, edgeWeightMap.at(edgeIt->first));
-					addEdge(edge);
+					auto edge = graphArena.create<DirectedWeightedEdge<T>>(edgeIt->first, *node1, *node2, edgeWeightMap.at(edgeIt->first));
+					edges.push_back(edge);
 				}
 				else
 				{
-					auto edge = new UndirectedWeightedEdge<T>(edgeIt->first, *node1, *node2, edgeWeightMap.at(edgeIt->first));
-					addEdge(edge);
+					auto edge = graphArena.create<UndirectedWeightedEdge<T>>(edgeIt->first, *node1, *node2, edgeWeightMap.at(edgeIt->first));
+					edges.push_back(edge);
 				}
 			}
 			else
 			{
 				if (edgeDirectedMap.find(edgeIt->first) != edgeDirectedMap.end() && edgeDirectedMap.at(edgeIt->first))
 				{
-					auto edge = new DirectedEdge<T>(edgeIt->first, *node1, *node2);
-					addEdge(edge);
+					auto edge = graphArena.create<DirectedEdge<T>>(edgeIt->first, *node1, *node2);
+					edges.push_back(edge);
 				}
 				else
 				{
-					auto edge = new UndirectedEdge<T>(edgeIt->first, *node1, *node2);
-					addEdge(edge);
+					auto edge = graphArena.create<UndirectedEdge<T>>(edgeIt->first, *node1, *node2);
+					edges.push_back(edge);
 				}
 			}
 		}
+		insertEdges(edges);
 	}
 
-	template <typename T>
-	int Graph<T>::compressFile(const std::string &inputFile, const std::string &outputFile) const
+	template <typename T, typename Policy>
+	int Graph<T, Policy>::compressFile(const std::string &inputFile, const std::string &outputFile) const
 	{
 
 		std::ifstream ifs;
@@ -766,8 +1863,8 @@ namespace CXXGRAPH
 		return 0;
 	}
 
-	template <typename T>
-	int Graph<T>::decompressFile(const std::string &inputFile, const std::string &outputFile) const
+	template <typename T, typename Policy>
+	int Graph<T, Policy>::decompressFile(const std::string &inputFile, const std::string &outputFile) const
 	{
 
 		gzFile inFileZ = gzopen(inputFile.c_str(), "rb");
@@ -808,8 +1905,8 @@ namespace CXXGRAPH
 		return 0;
 	}
 
-	template <typename T>
-	void Graph<T>::greedyPartition(PartitionMap<T> &partitionMap) const
+	template <typename T, typename Policy>
+	void Graph<T, Policy>::greedyPartition(PartitionMap<T> &partitionMap) const
 	{
 		unsigned int index = 0;
 		unsigned int numberOfPartitions = partitionMap.size();
@@ -827,224 +1924,1016 @@ namespace CXXGRAPH
 		}
 	}
 
-	template <typename T>
-	void Graph<T>::HDRFPartition(PartitionMap<T> &partitionMap) const
+	template <typename T, typename Policy>
+	void Graph<T, Policy>::HDRFPartition(PartitionMap<T> &partitionMap) const
 	{
 	}
 
-	template <typename T>
-	const AdjacencyMatrix<T> Graph<T>::getAdjMatrix() const
+	template <typename T, typename Policy>
+	const AdjacencyMatrix<T> Graph<T, Policy>::getAdjMatrix() const
+	{
+		return adjMatrix;
+	}
+
+	template <typename T, typename Policy>
+	const AdjacencyMatrix<T> &Graph<T, Policy>::getAdjMatrixRef() const
+	{
+		return adjMatrix;
+	}
+
+	template <typename T, typename Policy>
+	const std::shared_ptr<const CompactGraph<T, typename Policy::Weight>> Graph<T, Policy>::getCompactGraph() const
+	{
+		if (!appended.records.empty() || appended.nodes.size())
+		{
+			// the caller reads the CSR arrays, the appended links must be in them
+			compactSnapshots();
+		}
+		return getBaseCompactGraph();
+	}
+
+	template <typename T, typename Policy>
+	const std::shared_ptr<const CompactGraph<T, typename Policy::Weight>> Graph<T, Policy>::getBaseCompactGraph() const
+	{
+		if (!compactGraph)
+		{
+			compactGraph = std::make_shared<const CompactGraph<T, typename Policy::Weight>>(edgeSet);
+		}
+		return compactGraph;
+	}
+
+	template <typename T, typename Policy>
+	const std::shared_ptr<const CompactGraph<T, typename Policy::Weight>> Graph<T, Policy>::freeze() const
+	{
+		// the snapshot given outside the Graph must not contain dead links
+		compactSnapshots();
+		return getCompactGraph();
+	}
+
+	template <typename T, typename Policy>
+	const std::shared_ptr<const CompressedGraph<T, typename Policy::Weight>> Graph<T, Policy>::getCompressedGraph() const
+	{
+		if (!compressedGraph)
+		{
+			// encoded straight from the Edge Set, that never holds the Edges removed in tombstone mode
+			compressedGraph = std::make_shared<const CompressedGraph<T, typename Policy::Weight>>(edgeSet);
+		}
+		return compressedGraph;
+	}
+
+	template <typename T, typename Policy>
+	const std::shared_ptr<const EdgeColumns<T>> Graph<T, Policy>::getColumns() const
+	{
+		if (!edgeColumns)
+		{
+			edgeColumns = std::make_shared<const EdgeColumns<T>>(edgeSet);
+		}
+		return edgeColumns;
+	}
+
+	template <typename T, typename Policy>
+	const std::shared_ptr<const EdgeColumns<T>> Graph<T, Policy>::getEdgeColumns() const
+	{
+		return getColumns();
+	}
+
+	template <typename T, typename Policy>
+	void Graph<T, Policy>::resetSnapshots()
+	{
+		compactGraph.reset();
+		compressedGraph.reset();
+		edgeColumns.reset();
+		tombstones.clear();
+		numberOfTombstones = 0;
+		appended = AppendedLinks();
+	}
+
+	template <typename T, typename Policy>
+	bool Graph<T, Policy>::isSnapshotPatched() const
+	{
+		return numberOfTombstones || !appended.records.empty() || appended.nodes.size();
+	}
+
+	template <typename T, typename Policy>
+	void Graph<T, Policy>::appendToSnapshots(const Edge<T> *edge)
 	{
-		AdjacencyMatrix<T> adj;
-		auto edgeSetIt = edgeSet.begin();
-		for (edgeSetIt; edgeSetIt != edgeSet.end(); ++edgeSetIt)
+		compressedGraph.reset();
+		edgeColumns.reset();
+		if (!compactGraph)
+		{
+			// the next snapshot is built with the Edge
+			return;
+		}
+		const auto &compact = *compactGraph;
+		auto indexOf = [this, &compact](const Node<T> *node)
 		{
-			if ((*edgeSetIt)->isDirected().has_value() && (*edgeSetIt)->isDirected().value())
+			auto index = compact.getIndex(*node);
+			if (index.has_value())
 			{
-				const DirectedEdge<T> *d_edge = dynamic_cast<const DirectedEdge<T> *>(*edgeSetIt);
-				addElementToAdjMatrix(adj, &(d_edge->getFrom()), &(d_edge->getTo()), d_edge);
+				return index.value();
 			}
-			else if ((*edgeSetIt)->isDirected().has_value() && !(*edgeSetIt)->isDirected().value())
+			return static_cast<DenseIndex>(compact.getNumberOfNodes() + appended.nodes.insert(node));
+		};
+		auto from = indexOf(edge->getNodePair().first);
+		auto to = indexOf(edge->getNodePair().second);
+		appended.out.resize(compact.getNumberOfNodes() + appended.nodes.size());
+		appended.in.resize(compact.getNumberOfNodes() + appended.nodes.size());
+		auto append = [this, edge](DenseIndex from, DenseIndex to)
+		{
+			appended.out[from].push_back(appended.records.size());
+			appended.in[to].push_back(appended.records.size());
+			appended.records.push_back(CompactGraph<T, typename Policy::Weight>::makeRecord(from, to, edge));
+			appended.edges.push_back(edge);
+		};
+		if (edge->isDirected().has_value())
+		{
+			append(from, to);
+			if (!edge->isDirected().value())
 			{
-				const UndirectedEdge<T> *ud_edge = dynamic_cast<const UndirectedEdge<T> *>(*edgeSetIt);
-				;
-				addElementToAdjMatrix(adj, &(ud_edge->getNode1()), &(ud_edge->getNode2()), ud_edge);
-				addElementToAdjMatrix(adj, &(ud_edge->getNode2()), &(ud_edge->getNode1()), ud_edge);
+				append(to, from);
+			}
+		}
+		if (appended.records.size() > compactionThreshold * compact.getNumberOfLinks())
+		{
+			// the traversals would read too many links outside the CSR arrays, the next one rebuilds it
+			resetSnapshots();
+		}
+	}
+
+	template <typename T, typename Policy>
+	void Graph<T, Policy>::markTombstones(const Edge<T> *edge)
+	{
+		compressedGraph.reset();
+		edgeColumns.reset();
+		if (!edge->isDirected().has_value())
+		{
+			// a simple Edge has no links
+			return;
+		}
+		if (tombstones.empty())
+		{
+			tombstones.assign(compactGraph->getNumberOfLinks(), false);
+		}
+		// an appended link is unlinked from its Nodes, it still counts as a dead link
+		for (std::size_t position = 0; position < appended.edges.size(); ++position)
+		{
+			if (appended.edges[position] == edge)
+			{
+				const auto &record = appended.records[position];
+				auto &out = appended.out[record.from];
+				out.erase(std::find(out.begin(), out.end(), position));
+				auto &in = appended.in[record.to];
+				in.erase(std::find(in.begin(), in.end(), position));
+				appended.edges[position] = nullptr;
+				++numberOfTombstones;
+			}
+		}
+		const auto &offsets = compactGraph->getOffsets();
+		const auto &edges = compactGraph->getEdges();
+		auto mark = [this, &offsets, &edges, edge](const Node<T> *from)
+		{
+			auto index = compactGraph->getNodeIndex().getIndex(from->getId());
+			if (!index.has_value())
+			{
+				// the Node is new to the snapshot, the Edge has only appended links
+				return;
+			}
+			for (auto link = offsets[index.value()]; link < offsets[index.value() + 1]; ++link)
+			{
+				if (edges[link] == edge && !tombstones[link])
+				{
+					tombstones[link] = true;
+					++numberOfTombstones;
+					return;
+				}
+			}
+		};
+		mark(edge->getNodePair().first);
+		if (!edge->isDirected().value())
+		{
+			mark(edge->getNodePair().second);
+		}
+		if (numberOfTombstones > compactionThreshold * compactGraph->getNumberOfLinks())
+		{
+			compactSnapshots();
+		}
+	}
+
+	template <typename T, typename Policy>
+	void Graph<T, Policy>::compactSnapshots() const
+	{
+		if (isSnapshotPatched())
+		{
+			compactGraph = std::make_shared<const CompactGraph<T, typename Policy::Weight>>(edgeSet);
+			tombstones.clear();
+			numberOfTombstones = 0;
+			appended = AppendedLinks();
+		}
+	}
+
+	template <typename T, typename Policy>
+	bool Graph<T, Policy>::isTombstone(std::size_t link) const
+	{
+		return numberOfTombstones && tombstones[link];
+	}
+
+	template <typename T, typename Policy>
+	const std::optional<DenseIndex> Graph<T, Policy>::getLiveIndex(const CompactGraph<T, typename Policy::Weight> &compact, const Node<T> &node) const
+	{
+		auto index = compact.getIndex(node);
+		if (index.has_value() && numberOfTombstones && nodeRegistry.find(node.getId()) == nodeRegistry.end())
+		{
+			// all the Edges of the Node have been removed
+			return std::nullopt;
+		}
+		return index;
+	}
+
+	template <typename T, typename Policy>
+	void Graph<T, Policy>::setTombstoneRemoval(bool enabled)
+	{
+		tombstoneRemoval = enabled;
+		if (!tombstoneRemoval)
+		{
+			compactSnapshots();
+		}
+	}
+
+	template <typename T, typename Policy>
+	void Graph<T, Policy>::setCompactionThreshold(double threshold)
+	{
+		compactionThreshold = threshold;
+		if (compactGraph && numberOfTombstones > compactionThreshold * compactGraph->getNumberOfLinks())
+		{
+			compactSnapshots();
+		}
+	}
+
+	template <typename T, typename Policy>
+	std::size_t Graph<T, Policy>::getNumberOfTombstones() const
+	{
+		return numberOfTombstones;
+	}
+
+	template <typename T, typename Policy>
+	std::size_t Graph<T, Policy>::getNumberOfAppendedLinks() const
+	{
+		return appended.records.size();
+	}
+
+	template <typename T, typename Policy>
+	void Graph<T, Policy>::compact()
+	{
+		compactSnapshots();
+	}
+
+	template <typename T, typename Policy>
+	const std::shared_ptr<const CompressedGraph<T, typename Policy::Weight>> Graph<T, Policy>::freezeCompressed() const
+	{
+		return getCompressedGraph();
+	}
+
+	template <typename T, typename Policy>
+	void Graph<T, Policy>::setCompressedAdjacency(bool compressed)
+	{
+		compressedAdjacency = compressed;
+		if (compressedAdjacency)
+		{
+			// the tombstones and the appended links refer to the dropped CSR snapshot
+			compactGraph.reset();
+			tombstones.clear();
+			numberOfTombstones = 0;
+			appended = AppendedLinks();
+		}
+		else
+		{
+			compressedGraph.reset();
+		}
+	}
+
+	template <typename T, typename Policy>
+	bool Graph<T, Policy>::isCompressedAdjacency() const
+	{
+		return compressedAdjacency;
+	}
+
+	template <typename T, typename Policy>
+	const MemoryUsage Graph<T, Policy>::memoryUsage() const
+	{
+		MemoryUsage usage;
+		usage.graph = sizeof(*this);
+		usage.edgeSet = CXXGRAPH::memoryUsage(edgeSet);
+		for (auto edge : edgeSet)
+		{
+			bool directed = edge->isDirected().has_value() && edge->isDirected().value();
+			bool weighted = edge->isWeighted().has_value() && edge->isWeighted().value();
+			if (!edge->isDirected().has_value())
+			{
+				usage.edges += sizeof(Edge<T>);
+			}
+			else if (directed)
+			{
+				usage.edges += weighted ? sizeof(DirectedWeightedEdge<T>) : sizeof(DirectedEdge<T>);
 			}
 			else
-			{ //is a simple edge we cannot create adj matrix
-				return adj;
+			{
+				usage.edges += weighted ? sizeof(UndirectedWeightedEdge<T>) : sizeof(UndirectedEdge<T>);
+			}
+		}
+		usage.nodeSet = CXXGRAPH::memoryUsage(nodeSet);
+		usage.nodes = nodeSet.size() * sizeof(Node<T>);
+		usage.indexes = CXXGRAPH::memoryUsage(edgeIndex) + CXXGRAPH::memoryUsage(pairIndex) + CXXGRAPH::memoryUsage(nodeRegistry);
+		usage.adjacencyMatrix = CXXGRAPH::memoryUsage(adjMatrix);
+		for (const auto &adjacency : adjMatrix)
+		{
+			usage.adjacencyMatrix += CXXGRAPH::memoryUsage(adjacency.second);
+		}
+		if (compactGraph)
+		{
+			usage.snapshots += compactGraph->memoryUsage() + tombstones.capacity() / CHAR_BIT;
+			usage.snapshots += appended.nodes.memoryUsage() + CXXGRAPH::memoryUsage(appended.records) + CXXGRAPH::memoryUsage(appended.edges);
+			usage.snapshots += CXXGRAPH::memoryUsage(appended.out) + CXXGRAPH::memoryUsage(appended.in);
+			for (std::size_t index = 0; index < appended.out.size(); ++index)
+			{
+				usage.snapshots += CXXGRAPH::memoryUsage(appended.out[index]) + CXXGRAPH::memoryUsage(appended.in[index]);
+			}
+		}
+		if (compressedGraph)
+		{
+			usage.snapshots += compressedGraph->memoryUsage();
+		}
+		if (edgeColumns)
+		{
+			usage.snapshots += edgeColumns->memoryUsage();
+		}
+		if (arena)
+		{
+			usage.arena = arena->getReservedBytes() - arena->getAllocatedBytes();
+		}
+		usage.total = usage.graph + usage.edgeSet + usage.edges + usage.nodeSet + usage.nodes + usage.indexes + usage.adjacencyMatrix + usage.snapshots + usage.arena;
+		return usage;
+	}
+
+	template <typename T, typename Policy>
+	const DijkstraResult Graph<T, Policy>::dijkstra(const Node<T> &source, const Node<T> &target) const
+	{
+		if (compressedAdjacency)
+		{
+			return runDijkstra(*getCompressedGraph(), source, target);
+		}
+		if (isSnapshotPatched())
+		{
+			return runDijkstra(LiveCompactGraph(*this, *getBaseCompactGraph()), source, target);
+		}
+		return runDijkstra(*getCompactGraph(), source, target);
+	}
+
+	template <typename T, typename Policy>
+	template <typename Adjacency, typename Settled>
+	bool Graph<T, Policy>::runShortestPaths(const Adjacency &adjacency, DenseIndex source, ShortestPathWorkspace &workspace, Settled &&settled)
+	{
+		// the workspace starts with all the distances at INF_DOUBLE and every node as its own predecessor.
+		// Its min heap of the dense indices is keyed by their tentative distance,
+		// a shorter path to a node in the heap decrease its key instead of pushing a duplicate
+		auto &dist = workspace.dist;
+		auto &heap = workspace.heap;
+		dist[source] = 0;
+		workspace.touched.push_back(source);
+		heap.pushOrDecrease(source, 0.0);
+
+		bool noWeightedEdge = false;
+		while (!heap.empty())
+		{
+			auto [currentDist, currentNode] = heap.pop();
+			if (settled(currentNode))
+			{
+				// the searched nodes are settled, their distance can not decrease anymore
+				break;
 			}
+
+			// for all the reachable vertex from the currently exploring vertex
+			// we will try to minimize the distance
+			adjacency.forEachLink(currentNode, [&](const auto &record)
+								  {
+									  // minimizing distances, a policy of only Weighted Edges needs no check
+									  if (!Policy::allWeighted && !record.isWeighted())
+									  {
+										  noWeightedEdge = true;
+									  }
+									  else if (currentDist + record.weight < dist[record.to])
+									  {
+										  if (dist[record.to] == INF_DOUBLE)
+										  {
+											  workspace.touched.push_back(record.to);
+										  }
+										  dist[record.to] = currentDist + record.weight;
+										  workspace.predecessor[record.to] = currentNode;
+										  heap.pushOrDecrease(record.to, dist[record.to]);
+									  } });
+			if (noWeightedEdge)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	template <typename T, typename Policy>
+	template <typename Adjacency>
+	const DijkstraResult Graph<T, Policy>::runDijkstra(const Adjacency &adjacency, const Node<T> &source, const Node<T> &target)
+	{
+		DijkstraResult result;
+		result.success = false;
+		result.errorMessage = "";
+		result.result = INF_DOUBLE;
+		auto sourceIndex = adjacency.getIndex(source);
+		if (!sourceIndex.has_value())
+		{
+			// check if source node exist in the graph
+			result.errorMessage = ERR_SOURCE_NODE_NOT_IN_GRAPH;
+			return result;
+		}
+		auto targetIndex = adjacency.getIndex(target);
+		if (!targetIndex.has_value())
+		{
+			// check if target node exist in the graph
+			result.errorMessage = ERR_TARGET_NODE_NOT_IN_GRAPH;
+			return result;
+		}
+
+		ShortestPathWorkspace workspace(adjacency.getNumberOfNodes());
+		const auto &dist = workspace.dist;
+		const auto &predecessor = workspace.predecessor;
+		if (!runShortestPaths(adjacency, sourceIndex.value(), workspace, [&targetIndex](DenseIndex node)
+							  { return node == targetIndex.value(); }))
+		{
+			// No Weighted Edge
+			result.errorMessage = ERR_NO_WEIGHTED_EDGE;
+			return result;
 		}
-		return adj;
+		if (dist[targetIndex.value()] != INF_DOUBLE)
+		{
+			result.success = true;
+			result.errorMessage = "";
+			result.result = dist[targetIndex.value()];
+			// follow the predecessor chain back to the source
+			for (DenseIndex node = targetIndex.value();; node = predecessor[node])
+			{
+				result.path.push_back(adjacency.getNode(node)->getId());
+				if (node == sourceIndex.value())
+				{
+					break;
+				}
+			}
+			std::reverse(result.path.begin(), result.path.end());
+			return result;
+		}
+		result.errorMessage = ERR_TARGET_NODE_NOT_REACHABLE;
+		result.result = -1;
+		return result;
+	}
+
+	template <typename T, typename Policy>
+	template <typename Adjacency>
+	const DijkstraResult Graph<T, Policy>::runBidirectionalDijkstra(const Adjacency &adjacency, const Node<T> &source, const Node<T> &target)
+	{
+		DijkstraResult result;
+		result.success = false;
+		result.errorMessage = "";
+		result.result = INF_DOUBLE;
+		auto sourceIndex = adjacency.getIndex(source);
+		if (!sourceIndex.has_value())
+		{
+			// check if source node exist in the graph
+			result.errorMessage = ERR_SOURCE_NODE_NOT_IN_GRAPH;
+			return result;
+		}
+		auto targetIndex = adjacency.getIndex(target);
+		if (!targetIndex.has_value())
+		{
+			// check if target node exist in the graph
+			result.errorMessage = ERR_TARGET_NODE_NOT_IN_GRAPH;
+			return result;
+		}
+
+		// the predecessors of the backward search point toward the target
+		ShortestPathWorkspace forward(adjacency.getNumberOfNodes());
+		ShortestPathWorkspace backward(adjacency.getNumberOfNodes());
+		forward.dist[sourceIndex.value()] = 0;
+		forward.heap.pushOrDecrease(sourceIndex.value(), 0.0);
+		backward.dist[targetIndex.value()] = 0;
+		backward.heap.pushOrDecrease(targetIndex.value(), 0.0);
+
+		// length of the shortest path found so far and the node where its two halves meet
+		double best = sourceIndex.value() == targetIndex.value() ? 0 : INF_DOUBLE;
+		DenseIndex meeting = sourceIndex.value();
+		auto relax = [&best, &meeting](ShortestPathWorkspace &search, const ShortestPathWorkspace &opposite, DenseIndex from, DenseIndex to, double candidate)
+		{
+			if (candidate < search.dist[to])
+			{
+				search.dist[to] = candidate;
+				search.predecessor[to] = from;
+				search.heap.pushOrDecrease(to, candidate);
+			}
+			if (opposite.dist[to] != INF_DOUBLE && search.dist[to] + opposite.dist[to] < best)
+			{
+				best = search.dist[to] + opposite.dist[to];
+				meeting = to;
+			}
+		};
+
+		bool noWeightedEdge = false;
+		while (!forward.heap.empty() && !backward.heap.empty())
+		{
+			// no path through the unsettled nodes can be shorter than the best one
+			if (forward.heap.top().first + backward.heap.top().first >= best)
+			{
+				break;
+			}
+			// expand the frontier with the smaller key, so the two searches grow together
+			if (forward.heap.top().first <= backward.heap.top().first)
+			{
+				auto [currentDist, currentNode] = forward.heap.pop();
+				adjacency.forEachLink(currentNode, [&](const auto &record)
+									  {
+										  if (!Policy::allWeighted && !record.isWeighted())
+										  {
+											  noWeightedEdge = true;
+										  }
+										  else
+										  {
+											  relax(forward, backward, currentNode, record.to, currentDist + record.weight);
+										  } });
+			}
+			else
+			{
+				auto [currentDist, currentNode] = backward.heap.pop();
+				adjacency.forEachInLink(currentNode, [&](std::size_t, const auto &record)
+										{
+											if (!Policy::allWeighted && !record.isWeighted())
+											{
+												noWeightedEdge = true;
+											}
+											else
+											{
+												relax(backward, forward, currentNode, record.from, currentDist + record.weight);
+											} });
+			}
+			if (noWeightedEdge)
+			{
+				// No Weighted Edge
+				result.errorMessage = ERR_NO_WEIGHTED_EDGE;
+				return result;
+			}
+		}
+		if (best != INF_DOUBLE)
+		{
+			result.success = true;
+			result.errorMessage = "";
+			result.result = best;
+			// the forward half from the source to the meeting node, then the backward half to the target
+			for (DenseIndex node = meeting;; node = forward.predecessor[node])
+			{
+				result.path.push_back(adjacency.getNode(node)->getId());
+				if (node == sourceIndex.value())
+				{
+					break;
+				}
+			}
+			std::reverse(result.path.begin(), result.path.end());
+			for (DenseIndex node = meeting; node != targetIndex.value();)
+			{
+				node = backward.predecessor[node];
+				result.path.push_back(adjacency.getNode(node)->getId());
+			}
+			return result;
+		}
+		result.errorMessage = ERR_TARGET_NODE_NOT_REACHABLE;
+		result.result = -1;
+		return result;
+	}
+
+	template <typename T, typename Policy>
+	const DijkstraResult Graph<T, Policy>::bidirectionalDijkstra(const Node<T> &source, const Node<T> &target) const
+	{
+		// the compressed snapshot has no reverse index, the backward search needs the CSR one
+		if (isSnapshotPatched())
+		{
+			return runBidirectionalDijkstra(LiveCompactGraph(*this, *getBaseCompactGraph()), source, target);
+		}
+		return runBidirectionalDijkstra(*getCompactGraph(), source, target);
+	}
+
+	template <typename T, typename Policy>
+	template <typename Adjacency, typename Heuristic>
+	const DijkstraResult Graph<T, Policy>::runAstar(const Adjacency &adjacency, const Node<T> &source, const Node<T> &target, Heuristic &&heuristic)
+	{
+		DijkstraResult result;
+		result.success = false;
+		result.errorMessage = "";
+		result.result = INF_DOUBLE;
+		auto sourceIndex = adjacency.getIndex(source);
+		if (!sourceIndex.has_value())
+		{
+			// check if source node exist in the graph
+			result.errorMessage = ERR_SOURCE_NODE_NOT_IN_GRAPH;
+			return result;
+		}
+		auto targetIndex = adjacency.getIndex(target);
+		if (!targetIndex.has_value())
+		{
+			// check if target node exist in the graph
+			result.errorMessage = ERR_TARGET_NODE_NOT_IN_GRAPH;
+			return result;
+		}
+
+		// the heap is keyed by the distance from the source plus the estimate to the target,
+		// the estimate of a node is computed once, the first time the node is reached
+		ShortestPathWorkspace workspace(adjacency.getNumberOfNodes());
+		auto &dist = workspace.dist;
+		auto &heap = workspace.heap;
+		std::vector<double> estimate(adjacency.getNumberOfNodes(), INF_DOUBLE);
+		dist[sourceIndex.value()] = 0;
+		estimate[sourceIndex.value()] = heuristic(*adjacency.getNode(sourceIndex.value()));
+		heap.pushOrDecrease(sourceIndex.value(), estimate[sourceIndex.value()]);
+
+		bool noWeightedEdge = false;
+		while (!heap.empty())
+		{
+			auto currentNode = heap.pop().second;
+			if (currentNode == targetIndex.value())
+			{
+				// with an admissible heuristic the target is settled at its shortest distance
+				break;
+			}
+			adjacency.forEachLink(currentNode, [&](const auto &record)
+								  {
+									  if (!Policy::allWeighted && !record.isWeighted())
+									  {
+										  noWeightedEdge = true;
+									  }
+									  else if (dist[currentNode] + record.weight < dist[record.to])
+									  {
+										  dist[record.to] = dist[currentNode] + record.weight;
+										  workspace.predecessor[record.to] = currentNode;
+										  if (estimate[record.to] == INF_DOUBLE)
+										  {
+											  estimate[record.to] = heuristic(*adjacency.getNode(record.to));
+										  }
+										  // a settled node is pushed again if its distance decrease, an inconsistent heuristic can cause it
+										  heap.pushOrDecrease(record.to, dist[record.to] + estimate[record.to]);
+									  } });
+			if (noWeightedEdge)
+			{
+				// No Weighted Edge
+				result.errorMessage = ERR_NO_WEIGHTED_EDGE;
+				return result;
+			}
+		}
+		if (dist[targetIndex.value()] != INF_DOUBLE)
+		{
+			result.success = true;
+			result.errorMessage = "";
+			result.result = dist[targetIndex.value()];
+			// follow the predecessor chain back to the source
+			for (DenseIndex node = targetIndex.value();; node = workspace.predecessor[node])
+			{
+				result.path.push_back(adjacency.getNode(node)->getId());
+				if (node == sourceIndex.value())
+				{
+					break;
+				}
+			}
+			std::reverse(result.path.begin(), result.path.end());
+			return result;
+		}
+		result.errorMessage = ERR_TARGET_NODE_NOT_REACHABLE;
+		result.result = -1;
+		return result;
+	}
+
+	template <typename T, typename Policy>
+	template <typename Heuristic>
+	const DijkstraResult Graph<T, Policy>::astar(const Node<T> &source, const Node<T> &target, Heuristic &&heuristic) const
+	{
+		if (compressedAdjacency)
+		{
+			return runAstar(*getCompressedGraph(), source, target, std::forward<Heuristic>(heuristic));
+		}
+		if (isSnapshotPatched())
+		{
+			return runAstar(LiveCompactGraph(*this, *getBaseCompactGraph()), source, target, std::forward<Heuristic>(heuristic));
+		}
+		return runAstar(*getCompactGraph(), source, target, std::forward<Heuristic>(heuristic));
+	}
+
+	template <typename T, typename Policy>
+	template <typename Adjacency>
+	const DijkstraAllResult Graph<T, Policy>::runDijkstraAll(const Adjacency &adjacency, const Node<T> &source)
+	{
+		DijkstraAllResult result;
+		result.success = false;
+		result.errorMessage = "";
+		auto sourceIndex = adjacency.getIndex(source);
+		if (!sourceIndex.has_value())
+		{
+			// check if source node exist in the graph
+			result.errorMessage = ERR_SOURCE_NODE_NOT_IN_GRAPH;
+			return result;
+		}
+
+		ShortestPathWorkspace workspace(adjacency.getNumberOfNodes());
+		if (!runShortestPaths(adjacency, sourceIndex.value(), workspace, [](DenseIndex)
+							  { return false; }))
+		{
+			// No Weighted Edge
+			result.errorMessage = ERR_NO_WEIGHTED_EDGE;
+			return result;
+		}
+		result.distances = std::move(workspace.dist);
+		// the positions in the result are the dense indices of the snapshot
+		result.nodeIds.reserve(adjacency.getNumberOfNodes());
+		for (DenseIndex node = 0; node < adjacency.getNumberOfNodes(); ++node)
+		{
+			result.nodeIds.push_back(adjacency.getNode(node)->getId());
+		}
+		result.predecessors.assign(workspace.predecessor.begin(), workspace.predecessor.end());
+		result.success = true;
+		return result;
+	}
+
+	template <typename T, typename Policy>
+	const DijkstraAllResult Graph<T, Policy>::dijkstraAll(const Node<T> &source) const
+	{
+		if (compressedAdjacency)
+		{
+			return runDijkstraAll(*getCompressedGraph(), source);
+		}
+		if (!isSnapshotPatched())
+		{
+			return runDijkstraAll(*getCompactGraph(), source);
+		}
+		auto result = runDijkstraAll(LiveCompactGraph(*this, *getBaseCompactGraph()), source);
+		if (!result.success || !numberOfTombstones)
+		{
+			return result;
+		}
+		// skip the Nodes that have lost all their Edges in tombstone mode, they are
+		// not reachable so no kept Node has one of them as predecessor
+		std::vector<std::size_t> position(result.nodeIds.size());
+		std::size_t kept = 0;
+		for (std::size_t i = 0; i < result.nodeIds.size(); ++i)
+		{
+			if (nodeRegistry.find(result.nodeIds[i]) != nodeRegistry.end())
+			{
+				position[i] = kept;
+				result.nodeIds[kept] = result.nodeIds[i];
+				result.distances[kept] = result.distances[i];
+				result.predecessors[kept] = result.predecessors[i];
+				++kept;
+			}
+		}
+		result.nodeIds.resize(kept);
+		result.distances.resize(kept);
+		result.predecessors.resize(kept);
+		for (auto &predecessor : result.predecessors)
+		{
+			predecessor = position[predecessor];
+		}
+		return result;
 	}
 
-	template <typename T>
-	const DijkstraResult Graph<T>::dijkstra(const Node<T> &source, const Node<T> &target) const
+	template <typename T, typename Policy>
+	template <typename Adjacency>
+	const DijkstraBatchResult Graph<T, Policy>::runDijkstraBatch(const Adjacency &adjacency, const std::vector<const Node<T> *> &sources, const std::vector<const Node<T> *> &targets, unsigned int numberOfThreads)
 	{
-		DijkstraResult result;
+		DijkstraBatchResult result;
 		result.success = false;
 		result.errorMessage = "";
-		result.result = INF_DOUBLE;
-		auto nodeSet = getNodeSet();
-		if (std::find(nodeSet.begin(), nodeSet.end(), &source) == nodeSet.end())
+		result.numberOfTargets = targets.size();
+		std::vector<DenseIndex> sourceIndices;
+		sourceIndices.reserve(sources.size());
+		for (auto source : sources)
 		{
-			// check if source node exist in the graph
-			result.errorMessage = ERR_SOURCE_NODE_NOT_IN_GRAPH;
-			return result;
+			auto sourceIndex = adjacency.getIndex(*source);
+			if (!sourceIndex.has_value())
+			{
+				// check if source node exist in the graph
+				result.errorMessage = ERR_SOURCE_NODE_NOT_IN_GRAPH;
+				return result;
+			}
+			sourceIndices.push_back(sourceIndex.value());
 		}
-		if (std::find(nodeSet.begin(), nodeSet.end(), &target) == nodeSet.end())
+		std::vector<DenseIndex> targetIndices;
+		targetIndices.reserve(targets.size());
+		// the searches stop when all the distinct targets are settled
+		std::vector<bool> isTarget(adjacency.getNumberOfNodes(), false);
+		std::size_t distinctTargets = 0;
+		for (auto target : targets)
 		{
-			// check if target node exist in the graph
-			result.errorMessage = ERR_TARGET_NODE_NOT_IN_GRAPH;
+			auto targetIndex = adjacency.getIndex(*target);
+			if (!targetIndex.has_value())
+			{
+				// check if target node exist in the graph
+				result.errorMessage = ERR_TARGET_NODE_NOT_IN_GRAPH;
+				return result;
+			}
+			targetIndices.push_back(targetIndex.value());
+			if (!isTarget[targetIndex.value()])
+			{
+				isTarget[targetIndex.value()] = true;
+				distinctTargets++;
+			}
+		}
+		result.distances.assign(sources.size() * targets.size(), INF_DOUBLE);
+		if (sources.empty() || targets.empty())
+		{
+			result.success = true;
 			return result;
 		}
-		const AdjacencyMatrix<T> adj = getAdjMatrix();
-		// n denotes the number of vertices in graph
-		int n = adj.size();
-
-		// setting all the distances initially to INF_DOUBLE
-		std::map<const Node<T> *, double> dist;
 
-		for (auto elem : adj)
+		if (numberOfThreads == 0)
 		{
-			dist[elem.first] = INF_DOUBLE;
+			numberOfThreads = std::max(1u, std::thread::hardware_concurrency());
 		}
-
-		// creating a min heap using priority queue
-		// first element of pair contains the distance
-		// second element of pair contains the vertex
-		std::priority_queue<std::pair<double, const Node<T> *>, std::vector<std::pair<double, const Node<T> *>>,
-							std::greater<std::pair<double, const Node<T> *>>>
-			pq;
-
-		// pushing the source vertex 's' with 0 distance in min heap
-		pq.push(std::make_pair(0.0, &source));
-
-		// marking the distance of source as 0
-		dist[&source] = 0;
-
-		while (!pq.empty())
+		numberOfThreads = static_cast<unsigned int>(std::min<std::size_t>(numberOfThreads, sources.size()));
+		std::atomic<std::size_t> nextSource(0);
+		std::atomic<bool> noWeightedEdge(false);
+		auto worker = [&]()
 		{
-			// second element of pair denotes the node / vertex
-			const Node<T> *currentNode = pq.top().second;
-
-			// first element of pair denotes the distance
-			double currentDist = pq.top().first;
-
-			pq.pop();
-
-			// for all the reachable vertex from the currently exploring vertex
-			// we will try to minimize the distance
-			if (adj.find(currentNode) != adj.end())
+			// every thread reuses its workspace, only the nodes reached by a search are reset
+			ShortestPathWorkspace workspace(adjacency.getNumberOfNodes());
+			for (std::size_t i = nextSource++; i < sourceIndices.size() && !noWeightedEdge; i = nextSource++)
 			{
-				for (std::pair<const Node<T> *, const Edge<T> *> elem : adj.at(currentNode))
+				std::size_t remaining = distinctTargets;
+				if (!runShortestPaths(adjacency, sourceIndices[i], workspace, [&isTarget, &remaining](DenseIndex node)
+									  { return isTarget[node] && --remaining == 0; }))
 				{
-					// minimizing distances
-					if (elem.second->isWeighted().has_value() && elem.second->isWeighted().value())
-					{
-						if (elem.second->isDirected().has_value() && elem.second->isDirected().value())
-						{
-							const DirectedWeightedEdge<T> *dw_edge = dynamic_cast<const DirectedWeightedEdge<T> *>(elem.second);
-							if (currentDist + dw_edge->getWeight() < dist[elem.first])
-							{
-								dist[elem.first] = currentDist + dw_edge->getWeight();
-								pq.push(std::make_pair(dist[elem.first], elem.first));
-							}
-						}
-						else if (elem.second->isDirected().has_value() && !elem.second->isDirected().value())
-						{
-							const UndirectedWeightedEdge<T> *udw_edge = dynamic_cast<const UndirectedWeightedEdge<T> *>(elem.second);
-							if (currentDist + udw_edge->getWeight() < dist[elem.first])
-							{
-								dist[elem.first] = currentDist + udw_edge->getWeight();
-								pq.push(std::make_pair(dist[elem.first], elem.first));
-							}
-						}
-						else
-						{
-							//ERROR it shouldn't never returned ( does not exist a Node Weighted and not Directed/Undirected)
-							result.errorMessage = ERR_NO_DIR_OR_UNDIR_EDGE;
-							return result;
-						}
-					}
-					else
-					{
-						// No Weighted Edge
-						result.errorMessage = ERR_NO_WEIGHTED_EDGE;
-						return result;
-					}
+					noWeightedEdge = true;
+					break;
+				}
+				// every source owns a row of the matrix, the threads never write the same element
+				double *row = result.distances.data() + i * targetIndices.size();
+				for (std::size_t j = 0; j < targetIndices.size(); ++j)
+				{
+					row[j] = workspace.dist[targetIndices[j]];
 				}
+				workspace.clear();
 			}
+		};
+		std::vector<std::thread> pool;
+		pool.reserve(numberOfThreads - 1);
+		for (unsigned int i = 1; i < numberOfThreads; ++i)
+		{
+			pool.emplace_back(worker);
 		}
-		if (dist[&target] != INF_DOUBLE)
+		worker();
+		for (auto &thread : pool)
 		{
-			result.success = true;
-			result.errorMessage = "";
-			result.result = dist[&target];
+			thread.join();
+		}
+		if (noWeightedEdge)
+		{
+			// No Weighted Edge
+			result.errorMessage = ERR_NO_WEIGHTED_EDGE;
+			result.distances.clear();
 			return result;
 		}
-		result.errorMessage = ERR_TARGET_NODE_NOT_REACHABLE;
-		result.result = -1;
+		result.success = true;
 		return result;
 	}
 
-	template <typename T>
-	const std::vector<Node<T>> Graph<T>::breadth_first_search(const Node<T> &start) const
+	template <typename T, typename Policy>
+	const DijkstraBatchResult Graph<T, Policy>::dijkstraBatch(const std::vector<const Node<T> *> &sources, const std::vector<const Node<T> *> &targets, unsigned int numberOfThreads) const
+	{
+		// the snapshots are built here, before the threads read them
+		if (compressedAdjacency)
+		{
+			return runDijkstraBatch(*getCompressedGraph(), sources, targets, numberOfThreads);
+		}
+		if (isSnapshotPatched())
+		{
+			return runDijkstraBatch(LiveCompactGraph(*this, *getBaseCompactGraph()), sources, targets, numberOfThreads);
+		}
+		return runDijkstraBatch(*getCompactGraph(), sources, targets, numberOfThreads);
+	}
+
+	template <typename T, typename Policy>
+	const std::vector<Node<T>> Graph<T, Policy>::breadth_first_search(const Node<T> &start) const
+	{
+		if (compressedAdjacency)
+		{
+			return runBreadthFirstSearch(*getCompressedGraph(), start);
+		}
+		if (isSnapshotPatched())
+		{
+			return runBreadthFirstSearch(LiveCompactGraph(*this, *getBaseCompactGraph()), start);
+		}
+		return runBreadthFirstSearch(*getCompactGraph(), start);
+	}
+
+	template <typename T, typename Policy>
+	template <typename Adjacency>
+	const std::vector<Node<T>> Graph<T, Policy>::runBreadthFirstSearch(const Adjacency &adjacency, const Node<T> &start)
 	{
 		// vector to keep track of visited nodes
 		std::vector<Node<T>> visited;
-		auto nodeSet = getNodeSet();
+		auto startIndex = adjacency.getIndex(start);
 		//check is exist node in the graph
-		if (std::find(nodeSet.begin(), nodeSet.end(), &start) == nodeSet.end())
+		if (!startIndex.has_value())
 		{
 			return visited;
 		}
-		const AdjacencyMatrix<T> adj = getAdjMatrix();
+		// bitset of the visited nodes, indexed by dense index
+		std::vector<bool> isVisited(adjacency.getNumberOfNodes(), false);
 		// queue that stores vertices that need to be further explored
-		std::queue<const Node<T> *> tracker;
+		std::queue<DenseIndex> tracker;
 
 		// mark the starting node as visited
 		visited.push_back(start);
-		tracker.push(&start);
+		isVisited[startIndex.value()] = true;
+		tracker.push(startIndex.value());
 		while (!tracker.empty())
 		{
-			const Node<T> *node = tracker.front();
+			DenseIndex node = tracker.front();
 			tracker.pop();
-			if (adj.find(node) != adj.end())
-			{
-				for (auto elem : adj.at(node))
-				{
-					// if the node is not visited then mark it as visited
-					// and push it to the queue
-					if (std::find(visited.begin(), visited.end(), *(elem.first)) == visited.end())
-					{
-						visited.push_back(*(elem.first));
-						tracker.push(elem.first);
-					}
-				}
-			}
+			adjacency.forEachLink(node, [&](const auto &record)
+								  {
+									  // if the node is not visited then mark it as visited
+									  // and push it to the queue
+									  if (!isVisited[record.to])
+									  {
+										  isVisited[record.to] = true;
+										  visited.push_back(*(adjacency.getNode(record.to)));
+										  tracker.push(record.to);
+									  } });
 		}
 
 		return visited;
 	}
 
-	template <typename T>
-	const std::vector<Node<T>> Graph<T>::depth_first_search(const Node<T> &start) const
+	template <typename T, typename Policy>
+	const std::vector<Node<T>> Graph<T, Policy>::depth_first_search(const Node<T> &start) const
+	{
+		if (compressedAdjacency)
+		{
+			return runDepthFirstSearch(*getCompressedGraph(), start);
+		}
+		if (isSnapshotPatched())
+		{
+			return runDepthFirstSearch(LiveCompactGraph(*this, *getBaseCompactGraph()), start);
+		}
+		return runDepthFirstSearch(*getCompactGraph(), start);
+	}
+
+	template <typename T, typename Policy>
+	template <typename Adjacency>
+	const std::vector<Node<T>> Graph<T, Policy>::runDepthFirstSearch(const Adjacency &adjacency, const Node<T> &start)
 	{
 		// vector to keep track of visited nodes
 		std::vector<Node<T>> visited;
-		auto nodeSet = getNodeSet();
+		auto startIndex = adjacency.getIndex(start);
 		//check is exist node in the graph
-		if (std::find(nodeSet.begin(), nodeSet.end(), &start) == nodeSet.end())
+		if (!startIndex.has_value())
 		{
 			return visited;
 		}
-		const AdjacencyMatrix<T> adj = getAdjMatrix();
-		std::function<void(const AdjacencyMatrix<T> &, const Node<T> &, std::vector<Node<T>> &)> explore;
-		explore = [&explore](const AdjacencyMatrix<T> &adj, const Node<T> &node, std::vector<Node<T>> &visited) -> void
-		{
-			visited.push_back(node);
-			if (adj.find(&node) != adj.end())
+		// bitset of the visited nodes, indexed by dense index
+		std::vector<bool> isVisited(adjacency.getNumberOfNodes(), false);
+		// explicit stack of the nodes to explore. The neighbors are pushed in reverse order
+		// and marked when they are popped, so the nodes are visited in the same order of
+		// the recursive version without its depth limit
+		std::vector<DenseIndex> stack;
+		std::vector<DenseIndex> neighbors;
+		stack.push_back(startIndex.value());
+		while (!stack.empty())
+		{
+			DenseIndex node = stack.back();
+			stack.pop_back();
+			if (isVisited[node])
 			{
-				for (auto x : adj.at(&node))
-				{
-					if (std::find(visited.begin(), visited.end(), *(x.first)) == visited.end())
-					{
-						explore(adj, *(x.first), visited);
-					}
-				}
+				continue;
 			}
-		};
-		explore(adj, start, visited);
+			isVisited[node] = true;
+			visited.push_back(*(adjacency.getNode(node)));
+			neighbors.clear();
+			adjacency.forEachLink(node, [&](const auto &record)
+								  {
+									  if (!isVisited[record.to])
+									  {
+										  neighbors.push_back(record.to);
+									  } });
+			stack.insert(stack.end(), neighbors.rbegin(), neighbors.rend());
+		}
 
 		return visited;
 	}
 
-	template <typename T>
-	bool Graph<T>::isCyclicDirectedGraphDFS() const
+	template <typename T, typename Policy>
+	bool Graph<T, Policy>::isCyclicDirectedGraphDFS() const
 	{
-		if (!isDirectedGraph())
+		// not virtual call, Graph_TS already holds the lock
+		if (!Graph<T, Policy>::isDirectedGraph())
 		{
 			return false;
 		}
@@ -1054,8 +2943,9 @@ namespace CXXGRAPH
 			in_stack,
 			visited
 		};
-		auto nodeSet = this->getNodeSet();
-		auto adjMatrix = this->getAdjMatrix();
+		auto compact = getCompactGraph();
+		const auto &offsets = compact->getOffsets();
+		const auto &records = compact->getRecords();
 
 		/* State of the node.
          *
@@ -1064,62 +2954,57 @@ namespace CXXGRAPH
          *
          * Initially, all nodes are in "not_visited" state.
          */
-		std::map<unsigned long, nodeStates> state;
-		for (auto node : nodeSet)
-		{
-			state[node->getId()] = not_visited;
-		}
-		int stateCounter = 0;
+		std::vector<nodeStates> state(compact->getNumberOfNodes(), not_visited);
 
 		// Start visiting each node.
-		for (auto node : nodeSet)
+		for (DenseIndex node = 0; node < compact->getNumberOfNodes(); ++node)
 		{
 			// If a node is not visited, only then check for presence of cycle.
 			// There is no need to check for presence of cycle for a visited
 			// node as it has already been checked for presence of cycle.
-			if (state[node->getId()] == not_visited)
+			if (state[node] == not_visited)
 			{
 				// Check for cycle.
-				std::function<bool(AdjacencyMatrix<T> &, std::map<unsigned long, nodeStates> &, const Node<T> *)> isCyclicDFSHelper;
-				isCyclicDFSHelper = [this, &isCyclicDFSHelper](AdjacencyMatrix<T> &adjMatrix, std::map<unsigned long, nodeStates> &states, const Node<T> *node)
+				std::function<bool(std::vector<nodeStates> &, DenseIndex)> isCyclicDFSHelper;
+				isCyclicDFSHelper = [this, &isCyclicDFSHelper, &offsets, &records](std::vector<nodeStates> &states, DenseIndex node)
 				{
 					// Add node "in_stack" state.
-					states[node->getId()] = in_stack;
+					states[node] = in_stack;
 
 					// If the node has children, then recursively visit all children of the
 					// node.
-					auto const it = adjMatrix.find(node);
-					if (it != adjMatrix.end())
+					for (auto i = offsets[node]; i < offsets[node + 1]; ++i)
 					{
-						for (auto child : it->second)
+						if (isTombstone(i))
 						{
-							// If state of child node is "not_visited", evaluate that child
-							// for presence of cycle.
-							auto state_of_child = states.at((std::get<0>(child))->getId());
-							if (state_of_child == not_visited)
-							{
-								if (isCyclicDFSHelper(adjMatrix, states, std::get<0>(child)))
-								{
-									return true;
-								}
-							}
-							else if (state_of_child == in_stack)
+							continue;
+						}
+						// If state of child node is "not_visited", evaluate that child
+						// for presence of cycle.
+						auto state_of_child = states[records[i].to];
+						if (state_of_child == not_visited)
+						{
+							if (isCyclicDFSHelper(states, records[i].to))
 							{
-								// If child node was "in_stack", then that means that there
-								// is a cycle in the graph. Return true for presence of the
-								// cycle.
 								return true;
 							}
 						}
+						else if (state_of_child == in_stack)
+						{
+							// If child node was "in_stack", then that means that there
+							// is a cycle in the graph. Return true for presence of the
+							// cycle.
+							return true;
+						}
 					}
 
 					// Current node has been evaluated for the presence of cycle and had no
 					// cycle. Mark current node as "visited".
-					states[node->getId()] = visited;
+					states[node] = visited;
 					// Return that current node didn't result in any cycles.
 					return false;
 				};
-				if (isCyclicDFSHelper(adjMatrix, state, node))
+				if (isCyclicDFSHelper(state, node))
 				{
 					return true;
 				}
@@ -1131,44 +3016,53 @@ namespace CXXGRAPH
 		return false;
 	}
 
-	template <typename T>
-	bool Graph<T>::isCyclicDirectedGraphBFS() const
+	template <typename T, typename Policy>
+	bool Graph<T, Policy>::isCyclicDirectedGraphBFS() const
 	{
-		if (!isDirectedGraph())
+		// not virtual call, Graph_TS already holds the lock
+		if (!Graph<T, Policy>::isDirectedGraph())
 		{
 			return false;
 		}
-		auto adjMatrix = this->getAdjMatrix();
-		auto nodeSet = this->getNodeSet();
+		auto compact = getCompactGraph();
+		const auto &offsets = compact->getOffsets();
+		const auto &records = compact->getRecords();
 
-		std::map<unsigned long, unsigned int> indegree;
-		for (auto node : nodeSet)
+		std::vector<std::size_t> indegree(compact->getNumberOfNodes(), 0);
+		// Calculate the indegree i.e. the number of incident edges to the node.
+		if (!numberOfTombstones)
 		{
-			indegree[node->getId()] = 0;
+			// read it from the reverse index, shared by all the queries on the snapshot
+			const auto &reverseOffsets = compact->getReverseOffsets();
+			for (DenseIndex node = 0; node < compact->getNumberOfNodes(); ++node)
+			{
+				indegree[node] = reverseOffsets[node + 1] - reverseOffsets[node];
+			}
 		}
-		// Calculate the indegree i.e. the number of incident edges to the node.
-		for (auto const &list : adjMatrix)
+		else
 		{
-			auto children = list.second;
-			for (auto const &child : children)
+			for (std::size_t i = 0; i < records.size(); ++i)
 			{
-				indegree[std::get<0>(child)->getId()]++;
+				if (!isTombstone(i))
+				{
+					indegree[records[i].to]++;
+				}
 			}
 		}
 
-		std::queue<const Node<T> *> can_be_solved;
-		for (auto node : nodeSet)
+		std::queue<DenseIndex> can_be_solved;
+		for (DenseIndex node = 0; node < compact->getNumberOfNodes(); ++node)
 		{
 			// If a node doesn't have any input edges, then that node will
 			// definately not result in a cycle and can be visited safely.
-			if (!indegree[node->getId()])
+			if (!indegree[node])
 			{
-				can_be_solved.emplace(&(*node));
+				can_be_solved.emplace(node);
 			}
 		}
 
 		// Vertices that need to be traversed.
-		auto remain = this->getNodeSet().size();
+		auto remain = compact->getNumberOfNodes();
 		// While there are safe nodes that we can visit.
 		while (!can_be_solved.empty())
 		{
@@ -1179,18 +3073,14 @@ namespace CXXGRAPH
 			remain--;
 
 			// Visit all the children of the visited node.
-			auto it = adjMatrix.find(solved);
-			if (it != adjMatrix.end())
+			for (auto i = offsets[solved]; i < offsets[solved + 1]; ++i)
 			{
-				for (auto child : it->second)
+				// Check if we can visited the node safely.
+				if (!isTombstone(i) && --indegree[records[i].to] == 0)
 				{
-					// Check if we can visited the node safely.
-					if (--indegree[std::get<0>(child)->getId()] == 0)
-					{
-						// if node can be visited safely, then add that node to
-						// the visit queue.
-						can_be_solved.emplace(std::get<0>(child));
-					}
+					// if node can be visited safely, then add that node to
+					// the visit queue.
+					can_be_solved.emplace(records[i].to);
 				}
 			}
 		}
@@ -1200,152 +3090,485 @@ namespace CXXGRAPH
 		return !(remain == 0);
 	}
 
-	template <typename T>
-	bool Graph<T>::isDirectedGraph() const
+	template <typename T, typename Policy>
+	bool Graph<T, Policy>::isDirectedGraph() const
 	{
-		auto edgeSet = this->getEdgeSet();
-		for (auto edge : edgeSet)
+		if constexpr (Policy::kind == GraphKind::DIRECTED_GRAPH)
 		{
-			if (!(edge->isDirected().has_value() && edge->isDirected().value()))
-			{
-				//Found Undirected Edge
-				return false;
-			}
+			return true;
+		}
+		else if constexpr (Policy::kind == GraphKind::UNDIRECTED_GRAPH)
+		{
+			return edgeSet.empty();
+		}
+		else
+		{
+			// scan of the directed column, without copying the Edge Set or calling the Edges
+			return getColumns()->isAllDirected();
 		}
-		//No Undirected Edge
-		return true;
 	}
 
-	template <typename T>
-	const DialResult Graph<T>::dial(const Node<T> &source, int maxWeight) const
+	template <typename T, typename Policy>
+	const DialResult Graph<T, Policy>::dial(const Node<T> &source, int maxWeight) const
 	{
 		DialResult result;
 		result.success = false;
 
-		auto adj = getAdjMatrix();
-		auto nodeSet = getNodeSet();
+		auto compact = getCompactGraph();
+		auto sourceIndex = getLiveIndex(*compact, source);
 
-		if (std::find(nodeSet.begin(), nodeSet.end(), &source) == nodeSet.end())
+		if (!sourceIndex.has_value())
 		{
 			// check if source node exist in the graph
 			result.errorMessage = ERR_SOURCE_NODE_NOT_IN_GRAPH;
 			return result;
 		}
-		/* With each distance, iterator to that vertex in
-       		its bucket is stored so that vertex can be deleted
-       		in O(1) at time of updation. So
-    		dist[i].first = distance of ith vertex from src vertex
-    		dits[i].second = vertex i in bucket number */
-		unsigned int V = nodeSet.size();
-		std::map<const Node<T> *, std::pair<long, const Node<T> *>> dist;
-
-		// Initialize all distances as infinite (INF)
-		for (auto node : nodeSet)
+		if (maxWeight < 0)
 		{
-			dist[&(*node)].first = std::numeric_limits<long>::max();
+			result.errorMessage = ERR_WEIGHT_OUT_OF_RANGE;
+			return result;
 		}
+		const auto &offsets = compact->getOffsets();
+		const auto &records = compact->getRecords();
+		const std::size_t V = compact->getNumberOfNodes();
 
-		// Create buckets B[].
-		// B[i] keep vertex of distance label i
-		std::list<const Node<T> *> B[maxWeight * V + 1];
-
-		B[0].push_back(&source);
-		dist[&source].first = 0;
-
-		int idx = 0;
-		while (1)
+		// Initialize all distances as infinite (INF)
+		std::vector<long> dist(V, std::numeric_limits<long>::max());
+
+		/* The temporary labels are always in [d, d + maxWeight], where d is the
+		   label of the last vertex taken, so maxWeight + 1 buckets used in circle
+		   are enough: the bucket of the label l is l % (maxWeight + 1).
+		   Every bucket is a doubly linked list threaded through the vertices,
+		   so a vertex is moved to another bucket in O(1) when its label decrease. */
+		const std::size_t numberOfBuckets = static_cast<std::size_t>(maxWeight) + 1;
+		const DenseIndex NONE = std::numeric_limits<DenseIndex>::max();
+		std::vector<DenseIndex> head(numberOfBuckets, NONE);
+		std::vector<DenseIndex> next(V, NONE);
+		std::vector<DenseIndex> prev(V, NONE);
+		auto pushFront = [&](DenseIndex v)
+		{
+			auto &first = head[dist[v] % numberOfBuckets];
+			next[v] = first;
+			prev[v] = NONE;
+			if (first != NONE)
+			{
+				prev[first] = v;
+			}
+			first = v;
+		};
+		auto erase = [&](DenseIndex v)
 		{
-			// Go sequentially through buckets till one non-empty
-			// bucket is found
-			while (B[idx].size() == 0 && idx < maxWeight * V)
+			if (prev[v] != NONE)
+			{
+				next[prev[v]] = next[v];
+			}
+			else
+			{
+				head[dist[v] % numberOfBuckets] = next[v];
+			}
+			if (next[v] != NONE)
 			{
-				idx++;
+				prev[next[v]] = prev[v];
 			}
+		};
 
-			// If all buckets are empty, we are done.
-			if (idx == maxWeight * V)
+		dist[sourceIndex.value()] = 0;
+		pushFront(sourceIndex.value());
+		std::size_t queued = 1;
+		std::size_t idx = 0;
+		while (queued > 0)
+		{
+			// Go around the buckets till one non-empty bucket is found,
+			// its vertices have the minimum label
+			while (head[idx] == NONE)
 			{
-				break;
+				idx = (idx + 1) % numberOfBuckets;
 			}
 
 			// Take top vertex from bucket and pop it
-			auto u = B[idx].front();
-			B[idx].pop_front();
+			auto u = head[idx];
+			erase(u);
+			--queued;
 
 			// Process all adjacents of extracted vertex 'u' and
 			// update their distanced if required.
-			for (auto i = adj[u].begin(); i != adj[u].end(); ++i)
+			for (auto i = offsets[u]; i < offsets[u + 1]; ++i)
 			{
-				auto v = (*i).first;
-				int weight = 0;
-				if ((*i).second->isWeighted().has_value() && (*i).second->isWeighted().value())
+				if (isTombstone(i))
 				{
-					if ((*i).second->isDirected().has_value() && (*i).second->isDirected().value())
-					{
-						const DirectedWeightedEdge<T> *dw_edge = dynamic_cast<const DirectedWeightedEdge<T> *>((*i).second);
-						weight = dw_edge->getWeight();
-					}
-					else if ((*i).second->isDirected().has_value() && !(*i).second->isDirected().value())
-					{
-						const UndirectedWeightedEdge<T> *udw_edge = dynamic_cast<const UndirectedWeightedEdge<T> *>((*i).second);
-						weight = udw_edge->getWeight();
-					}
-					else
-					{
-						//ERROR it shouldn't never returned ( does not exist a Node Weighted and not Directed/Undirected)
-						result.errorMessage = ERR_NO_DIR_OR_UNDIR_EDGE;
-						return result;
-					}
+					continue;
 				}
-				else
+				const auto &record = records[i];
+				auto v = record.to;
+				if (!Policy::allWeighted && !record.isWeighted())
 				{
 					// No Weighted Edge
 					result.errorMessage = ERR_NO_WEIGHTED_EDGE;
 					return result;
 				}
-				auto u_i = std::find_if(dist.begin(), dist.end(), [u](std::pair<const Node<T> *, std::pair<long, const Node<T> *>> const &it)
-										{ return (*u == *(it.first)); });
-
-				auto v_i = std::find_if(dist.begin(), dist.end(), [v](std::pair<const Node<T> *, std::pair<long, const Node<T> *>> const &it)
-										{ return (*v == *(it.first)); });
-				long du = u_i->second.first;
-				long dv = v_i->second.first;
+				double value = static_cast<double>(record.weight);
+				if (!std::isfinite(value) || std::floor(value) != value || value < 0 || value > maxWeight)
+				{
+					// a label out of the circle would share the bucket of a lower one,
+					// a weight that is not an integer has no bucket
+					result.errorMessage = ERR_WEIGHT_OUT_OF_RANGE;
+					return result;
+				}
+				long weight = static_cast<long>(value);
 
 				// If there is shorted path to v through u.
-				if (dv > du + weight)
+				if (dist[v] > dist[u] + weight)
 				{
-					// If dv is not INF then it must be in B[dv]
-					// bucket, so erase its entry using iterator
-					// in O(1)
-					if (dv != std::numeric_limits<long>::max())
+					// If dv is not INF then it is in its bucket, unlink it in O(1)
+					if (dist[v] != std::numeric_limits<long>::max())
+					{
+						erase(v);
+					}
+					else
 					{
-						auto findIter = std::find(B[dv].begin(), B[dv].end(), dist[v].second);
-						B[dv].erase(findIter);
+						++queued;
 					}
 
-					//  updating the distance
-					dist[v].first = du + weight;
-					dv = dist[v].first;
+					//  updating the distance and pushing vertex v into its bucket
+					dist[v] = dist[u] + weight;
+					pushFront(v);
+				}
+			}
+		}
+		result.nodeIds.reserve(V);
+		result.distances.reserve(V);
+		for (DenseIndex node = 0; node < V; ++node)
+		{
+			// skip the Nodes that have lost all their Edges in tombstone mode
+			if (!numberOfTombstones || nodeRegistry.find(compact->getNode(node)->getId()) != nodeRegistry.end())
+			{
+				result.nodeIds.push_back(compact->getNode(node)->getId());
+				result.distances.push_back(dist[node]);
+			}
+		}
+		result.success = true;
+
+		return result;
+	}
+
+	template <typename T, typename Policy>
+	template <typename Adjacency>
+	void Graph<T, Policy>::runDeltaStepping(const Adjacency &adjacency, DenseIndex source, double delta, unsigned int numberOfThreads, std::vector<double> &distances)
+	{
+		const std::size_t V = adjacency.getNumberOfNodes();
+		if (numberOfThreads == 0)
+		{
+			numberOfThreads = std::max(1u, std::thread::hardware_concurrency());
+		}
+		numberOfThreads = static_cast<unsigned int>(std::min<std::size_t>(numberOfThreads, V));
+
+		// the distances are lowered with a compare and swap, the threads relax the links of
+		// different nodes of the same phase that can reach the same node
+		std::vector<std::atomic<double>> dist(V);
+		for (auto &d : dist)
+		{
+			d.store(INF_DOUBLE, std::memory_order_relaxed);
+		}
+		dist[source].store(0, std::memory_order_relaxed);
+		// the bucket number is kept as a double, a distance over delta can overflow any integer
+		auto bucketOf = [delta](double distance)
+		{ return std::floor(distance / delta); };
+
+		// a node is pushed in the bucket of every distance it gets, the old entries are skipped.
+		// Only the non-empty buckets are in the map, the distances can be far apart compared to delta
+		std::map<double, std::vector<DenseIndex>> buckets;
+		buckets[0].push_back(source);
+		double current = 0;
+		// the nodes whose distance has been lowered by each thread during the phase
+		std::vector<std::vector<DenseIndex>> reached(numberOfThreads);
+		// the nodes of the phase, and the nodes removed from the current bucket for the heavy phase
+		std::vector<DenseIndex> frontier;
+		std::vector<DenseIndex> removed;
+		const std::size_t NOT_TAKEN = std::numeric_limits<std::size_t>::max();
+		std::vector<std::size_t> takenInPhase(V, NOT_TAKEN);
+		std::vector<std::size_t> removedFromBucket(V, NOT_TAKEN);
+		std::size_t phase = 0;
+		// a bucket can be visited again, if a heavy link falls in it when the distances are too large for delta
+		std::size_t visit = 0;
+		bool heavyPhase = false;
+		bool done = false;
+
+		// serial step between two phases, run by the last thread at the barrier
+		auto nextPhase = [&]()
+		{
+			for (auto &nodes : reached)
+			{
+				for (auto node : nodes)
+				{
+					buckets[bucketOf(dist[node].load(std::memory_order_relaxed))].push_back(node);
+				}
+				nodes.clear();
+			}
+			frontier.clear();
+			while (true)
+			{
+				auto bucket = buckets.find(current);
+				if (!heavyPhase && bucket != buckets.end())
+				{
+					++phase;
+					for (auto node : bucket->second)
+					{
+						// skip the entries of the nodes that have moved to a lower bucket, or are already taken
+						if (bucketOf(dist[node].load(std::memory_order_relaxed)) == current && takenInPhase[node] != phase)
+						{
+							takenInPhase[node] = phase;
+							frontier.push_back(node);
+							if (removedFromBucket[node] != visit)
+							{
+								removedFromBucket[node] = visit;
+								removed.push_back(node);
+							}
+						}
+					}
+					buckets.erase(bucket);
+					if (!frontier.empty())
+					{
+						return;
+					}
+				}
+				if (!heavyPhase)
+				{
+					// the bucket stays empty, the heavy links of its nodes are relaxed once
+					heavyPhase = true;
+					frontier.swap(removed);
+					if (!frontier.empty())
+					{
+						return;
+					}
+				}
+				heavyPhase = false;
+				// every distance lowered from the current bucket falls in the same or a next bucket
+				if (buckets.empty())
+				{
+					done = true;
+					return;
+				}
+				current = buckets.begin()->first;
+				++visit;
+			}
+		};
 
-					// pushing vertex v into updated distance's bucket
-					B[dv].push_front(v);
+		Barrier barrier(numberOfThreads);
+		auto worker = [&](unsigned int thread)
+		{
+			while (true)
+			{
+				barrier.arriveAndWait(nextPhase);
+				if (done)
+				{
+					return;
+				}
+				// the threads take the nodes of the frontier in turn, the light links in a light
+				// phase and the heavy links in a heavy phase
+				for (std::size_t i = thread; i < frontier.size(); i += numberOfThreads)
+				{
+					auto node = frontier[i];
+					double nodeDist = dist[node].load(std::memory_order_relaxed);
+					adjacency.forEachLink(node, [&](const auto &record)
+										  {
+											  if ((record.weight > delta) != heavyPhase)
+											  {
+												  return;
+											  }
+											  double candidate = nodeDist + record.weight;
+											  double old = dist[record.to].load(std::memory_order_relaxed);
+											  while (candidate < old)
+											  {
+												  if (dist[record.to].compare_exchange_weak(old, candidate, std::memory_order_relaxed))
+												  {
+													  reached[thread].push_back(record.to);
+													  break;
+												  }
+											  } });
+				}
+			}
+		};
+		std::vector<std::thread> pool;
+		pool.reserve(numberOfThreads - 1);
+		for (unsigned int i = 1; i < numberOfThreads; ++i)
+		{
+			pool.emplace_back(worker, i);
+		}
+		worker(0);
+		for (auto &thread : pool)
+		{
+			thread.join();
+		}
+		distances.resize(V);
+		for (DenseIndex node = 0; node < V; ++node)
+		{
+			distances[node] = dist[node].load(std::memory_order_relaxed);
+		}
+	}
 
-					// storing updated iterator in dist[v].second
-					dist[v].second = *(B[dv].begin());
+	template <typename T, typename Policy>
+	const DeltaSteppingResult Graph<T, Policy>::deltaStepping(const Node<T> &source, double delta, unsigned int numberOfThreads) const
+	{
+		DeltaSteppingResult result;
+		result.success = false;
+		if (!(delta > 0))
+		{
+			result.errorMessage = ERR_DELTA_NOT_POSITIVE;
+			return result;
+		}
+		auto solve = [&](const auto &adjacency)
+		{
+			auto sourceIndex = adjacency.getIndex(source);
+			if (!sourceIndex.has_value())
+			{
+				// check if source node exist in the graph
+				result.errorMessage = ERR_SOURCE_NODE_NOT_IN_GRAPH;
+				return;
+			}
+			// the weights are checked before the threads start, an error can not be thrown
+			// from the serial step of the barrier
+			for (DenseIndex node = 0; node < adjacency.getNumberOfNodes() && result.errorMessage.empty(); ++node)
+			{
+				adjacency.forEachLink(node, [&result](const auto &record)
+									  {
+										  if (!Policy::allWeighted && !record.isWeighted())
+										  {
+											  // No Weighted Edge
+											  result.errorMessage = ERR_NO_WEIGHTED_EDGE;
+										  }
+										  else if (!(record.weight >= 0))
+										  {
+											  // a negative weight, or not a number, would never settle a bucket
+											  result.errorMessage = ERR_WEIGHT_OUT_OF_RANGE;
+										  } });
+			}
+			if (!result.errorMessage.empty())
+			{
+				return;
+			}
+			std::vector<double> distances;
+			runDeltaStepping(adjacency, sourceIndex.value(), delta, numberOfThreads, distances);
+			result.nodeIds.reserve(distances.size());
+			result.distances.reserve(distances.size());
+			for (DenseIndex node = 0; node < distances.size(); ++node)
+			{
+				// skip the Nodes that have lost all their Edges in tombstone mode
+				if (!numberOfTombstones || nodeRegistry.find(adjacency.getNode(node)->getId()) != nodeRegistry.end())
+				{
+					result.nodeIds.push_back(adjacency.getNode(node)->getId());
+					result.distances.push_back(distances[node]);
 				}
 			}
+			result.success = true;
+		};
+		// the snapshots are built here, before the threads read them
+		if (compressedAdjacency)
+		{
+			solve(*getCompressedGraph());
 		}
-		for (auto dist_i : dist)
+		else if (isSnapshotPatched())
 		{
-			result.minDistanceMap[dist_i.first->getId()] = dist_i.second.first;
+			solve(LiveCompactGraph(*this, *getBaseCompactGraph()));
 		}
-		result.success = true;
+		else
+		{
+			solve(*getCompactGraph());
+		}
+		return result;
+	}
 
+	template <typename T, typename Policy>
+	const DialResult Graph<T, Policy>::radixDijkstra(const Node<T> &source) const
+	{
+		DialResult result;
+		result.success = false;
+		auto solve = [&](const auto &adjacency)
+		{
+			auto sourceIndex = adjacency.getIndex(source);
+			if (!sourceIndex.has_value())
+			{
+				// check if source node exist in the graph
+				result.errorMessage = ERR_SOURCE_NODE_NOT_IN_GRAPH;
+				return;
+			}
+			const std::size_t V = adjacency.getNumberOfNodes();
+			std::vector<long> dist(V, std::numeric_limits<long>::max());
+			// a node is pushed again when its distance decrease, the stale entries are skipped
+			RadixHeap<unsigned long> heap;
+			dist[sourceIndex.value()] = 0;
+			heap.push(0, sourceIndex.value());
+			while (!heap.empty())
+			{
+				auto [currentDist, currentNode] = heap.pop();
+				if (static_cast<long>(currentDist) != dist[currentNode])
+				{
+					continue;
+				}
+				bool weightError = false;
+				adjacency.forEachLink(currentNode, [&](const auto &record)
+									  {
+										  if (weightError)
+										  {
+											  return;
+										  }
+										  if (!Policy::allWeighted && !record.isWeighted())
+										  {
+											  // No Weighted Edge
+											  result.errorMessage = ERR_NO_WEIGHTED_EDGE;
+											  weightError = true;
+											  return;
+										  }
+										  double value = static_cast<double>(record.weight);
+										  if (!std::isfinite(value) || std::floor(value) != value || value < 0 ||
+											  value >= static_cast<double>(std::numeric_limits<long>::max()))
+										  {
+											  // the keys of the radix heap can not go back, and a weight
+											  // that is not an integer would be truncated
+											  result.errorMessage = ERR_WEIGHT_OUT_OF_RANGE;
+											  weightError = true;
+											  return;
+										  }
+										  long weight = static_cast<long>(value);
+										  if (dist[currentNode] + weight < dist[record.to])
+										  {
+											  dist[record.to] = dist[currentNode] + weight;
+											  heap.push(static_cast<unsigned long>(dist[record.to]), record.to);
+										  } });
+				if (weightError)
+				{
+					return;
+				}
+			}
+			result.nodeIds.reserve(V);
+			result.distances.reserve(V);
+			for (DenseIndex node = 0; node < V; ++node)
+			{
+				// skip the Nodes that have lost all their Edges in tombstone mode
+				if (!numberOfTombstones || nodeRegistry.find(adjacency.getNode(node)->getId()) != nodeRegistry.end())
+				{
+					result.nodeIds.push_back(adjacency.getNode(node)->getId());
+					result.distances.push_back(dist[node]);
+				}
+			}
+			result.success = true;
+		};
+		if (compressedAdjacency)
+		{
+			solve(*getCompressedGraph());
+		}
+		else if (isSnapshotPatched())
+		{
+			solve(LiveCompactGraph(*this, *getBaseCompactGraph()));
+		}
+		else
+		{
+			solve(*getCompactGraph());
+		}
 		return result;
 	}
 
-	template <typename T>
-	int Graph<T>::writeToFile(InputOutputFormat format, const std::string &workingDir, const std::string &OFileName, bool compress, bool writeNodeFeat, bool writeEdgeWeight) const
+	template <typename T, typename Policy>
+	int Graph<T, Policy>::writeToFile(InputOutputFormat format, const std::string &workingDir, const std::string &OFileName, bool compress, bool writeNodeFeat, bool writeEdgeWeight) const
 	{
 		int result = 0;
 		if (format == InputOutputFormat::STANDARD_CSV)
@@ -1417,8 +3640,8 @@ namespace CXXGRAPH
 		return result;
 	}
 
-	template <typename T>
-	int Graph<T>::readFromFile(InputOutputFormat format, const std::string &workingDir, const std::string &OFileName, bool compress, bool readNodeFeat, bool readEdgeWeight)
+	template <typename T, typename Policy>
+	int Graph<T, Policy>::readFromFile(InputOutputFormat format, const std::string &workingDir, const std::string &OFileName, bool compress, bool readNodeFeat, bool readEdgeWeight)
 	{
 		int result = 0;
 		if (compress)
@@ -1481,8 +3704,8 @@ namespace CXXGRAPH
 		return result;
 	}
 
-	template <typename T>
-	PartitionMap<T> Graph<T>::partitionGraph(PARTITIONING::PartitionAlgorithm algorithm, unsigned int numberOfPartitions) const
+	template <typename T, typename Policy>
+	PartitionMap<T> Graph<T, Policy>::partitionGraph(PARTITIONING::PartitionAlgorithm algorithm, unsigned int numberOfPartitions) const
 	{
 		PartitionMap<T> partitionMap;
 		for (unsigned int i = 0; i < numberOfPartitions; ++i)
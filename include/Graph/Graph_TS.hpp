@@ -28,13 +28,23 @@ namespace CXXGRAPH
 {
 
     /// Class that implement the Thread Safe Graph.
+    /// Readers that run long jobs can take an immutable snapshot() of the current version
+    /// and traverse it without holding the lock, while the writers keep updating the Graph.
     template <typename T>
     class Graph_TS : public Graph<T>, public ThreadSafe
     {
+    private:
+        // immutable copy of the current version, built by the first snapshot() after a write
+        mutable std::shared_ptr<const Graph<T>> currentSnapshot;
+        std::uint64_t version = 0;
+        void publishVersion();
+
     public:
         Graph_TS() = default;
         Graph_TS(const std::list<const Edge<T> *> &edgeSet);
         Graph_TS(const Graph<T> &graph);
+        /// The moved Graph is left empty, its Edge Set and indexes are taken over without copies
+        Graph_TS(Graph<T> &&graph);
         ~Graph_TS() = default;
         /**
  		* \brief
@@ -44,7 +54,7 @@ namespace CXXGRAPH
  		* @returns a list of Edges of the graph
  		*
  		*/
-        const std::list<const Edge<T> *> &getEdgeSet() const override;
+        const std::list<const Edge<T> *> getEdgeSet() const override;
         /**
  		* \brief
  		* Function set the Edge Set of the Graph
@@ -63,6 +73,37 @@ namespace CXXGRAPH
  		*
  		*/
         void addEdge(const Edge<T> *edge) override;
+        /**
+ 		* \brief
+ 		* Function add an Edge to the Graph Edge Set and give its ownership to the Graph
+		* Note: Thread Safe
+ 		*
+ 		* @param edge The Edge to insert
+ 		* @returns the inserted Edge, or nullptr if it has been discarded
+ 		*
+ 		*/
+        const Edge<T> *addEdge(std::unique_ptr<const Edge<T>> edge) override;
+        /**
+ 		* \brief
+ 		* Function that create a Node owned by the Graph
+		* Note: Thread Safe
+ 		*
+ 		* @param id The id of the Node
+ 		* @param data The data of the Node
+ 		* @returns the created Node
+ 		*
+ 		*/
+        const Node<T> *createNode(unsigned long id, const T &data) override;
+        /**
+ 		* \brief
+ 		* Function add a batch of Edges to the Graph Edge Set, taking the lock once
+		* Note: Thread Safe
+ 		*
+ 		* @param edges The Edges to insert
+ 		*
+ 		*/
+        void addEdges(const std::vector<const Edge<T> *> &edges) override;
+        using Graph<T>::addEdges;
         /**
  		* \brief
  		* Function remove an Edge from the Graph Edge Set
@@ -81,6 +122,69 @@ namespace CXXGRAPH
  		*
  		*/
         const std::list<const Node<T> *> getNodeSet() const override;
+        /**
+ 		* \brief
+ 		* Function that return a Node with specific ID if Exist in the Graph
+		* Note: Thread Safe
+ 		*
+		* @param nodeId The Node Id to return
+ 		* @returns the Node if exist
+ 		*
+ 		*/
+        const std::optional<const Node<T> *> getNode(unsigned long nodeId) const override;
+        /**
+ 		* \brief
+ 		* Function that return the number of links that enter a Node
+		* Note: Thread Safe
+ 		*
+		* @param node The Node
+ 		* @returns the in degree of the Node, 0 if the Node is not in the Graph
+ 		*
+ 		*/
+        std::size_t getInDegree(const Node<T> &node) const override;
+        /**
+ 		* \brief
+ 		* Function that return the source Nodes of the links that enter a Node
+		* Note: Thread Safe
+ 		*
+		* @param node The Node
+ 		* @returns the predecessors of the Node, one for each incoming link
+ 		*
+ 		*/
+        const std::vector<const Node<T> *> getPredecessors(const Node<T> &node) const override;
+        /**
+ 		* \brief
+ 		* Function that check if there is a link from a Node to another Node
+		* Note: Thread Safe
+ 		*
+		* @param nodeFrom The source Node
+		* @param nodeTo The destination Node
+ 		* @returns true if an Edge link nodeFrom to nodeTo
+ 		*
+ 		*/
+        bool hasEdge(const Node<T> &nodeFrom, const Node<T> &nodeTo) const override;
+        /**
+ 		* \brief
+ 		* Function that return all the Edges that link a Node to another Node
+		* Note: Thread Safe
+ 		*
+		* @param nodeFrom The source Node
+		* @param nodeTo The destination Node
+ 		* @returns the Edges that link nodeFrom to nodeTo
+ 		*
+ 		*/
+        const std::vector<const Edge<T> *> getEdgesBetween(const Node<T> &nodeFrom, const Node<T> &nodeTo) const override;
+        /**
+ 		* \brief
+ 		* Function that return a range over the outgoing links of a Node, for range-based for loops.
+		* The range hold the CSR snapshot, so it can be iterated without the lock.
+		* Note: Thread Safe
+ 		*
+		* @param node The Node
+ 		* @returns the range of the Neighbors of the Node, empty if the Node is not in the Graph
+ 		*
+ 		*/
+        NeighborRange<T> neighbors(const Node<T> &node) const override;
         /**
  		* \brief
  		* Function that return an Edge with specific ID if Exist in the Graph
@@ -97,6 +201,105 @@ namespace CXXGRAPH
 		* Note: Thread Safe
 		*/
         const AdjacencyMatrix<T> getAdjMatrix() const override;
+        // getAdjMatrixRef is not overridden: the lock can not guard the reference after the
+        // function returns, the readers of a Graph_TS use getAdjMatrix or snapshot instead
+        /**
+		* \brief
+		* Function that return an immutable CSR (Compressed Sparse Row) snapshot of the Graph.
+		* The snapshot is built once and cached until the Edge Set is modified, so repeated
+		* queries over a graph that rarely change do not pay the construction cost again.
+		* Note: Thread Safe
+		*
+		* @returns the CSR snapshot of the graph
+		*/
+        const std::shared_ptr<const CompactGraph<T>> freeze() const override;
+        /**
+		* \brief
+		* Function that return an immutable compressed snapshot of the Graph, with the
+		* adjacency lists gap encoded with varints. It is cached like the CSR snapshot.
+		* Note: Thread Safe
+		*
+		* @returns the compressed snapshot of the graph
+		*/
+        const std::shared_ptr<const CompressedGraph<T>> freezeCompressed() const override;
+        /**
+		* \brief
+		* Function that select the snapshot used by BFS, DFS and Dijkstra. With the compressed
+		* adjacency the links are decoded on the fly and visited in order of dense index of the
+		* destination, instead of the order of the Edge Set. The other algorithms use the CSR snapshot.
+		* Note: Thread Safe
+		*
+		* @param compressed true to use the compressed snapshot
+		*/
+        void setCompressedAdjacency(bool compressed) override;
+        /**
+		* \brief
+		* Function that return if BFS, DFS and Dijkstra use the compressed snapshot
+		* Note: Thread Safe
+		*
+		* @returns true if the compressed snapshot is used
+		*/
+        bool isCompressedAdjacency() const override;
+        /**
+		* \brief
+		* Function that return an immutable Structure of Arrays snapshot of the Edge Set,
+		* with the ids, the Nodes, the weights and the flags of the Edges in separate columns.
+		* It is cached like the CSR snapshot.
+		* Note: Thread Safe
+		*
+		* @returns the columns of the Edge Set
+		*/
+        const std::shared_ptr<const EdgeColumns<T>> getEdgeColumns() const override;
+        /**
+		* \brief
+		* Function that return an estimate of the memory used by the Graph, split by component.
+		* The Edge and Node objects are counted even if they are not owned by the Graph.
+		* Note: Thread Safe
+		*
+		* @returns the memory usage in bytes
+		*/
+        const MemoryUsage memoryUsage() const override;
+        /**
+		* \brief
+		* Function that enable the tombstone removal mode. In this mode removeEdge does not
+		* invalidate the CSR snapshot: the links of the removed Edge are marked dead and skipped
+		* by the algorithms, until the number of dead links cross the compaction threshold.
+		* Note: Thread Safe
+		*
+		* @param enabled true to enable the tombstone removal mode
+		*/
+        void setTombstoneRemoval(bool enabled) override;
+        /**
+		* \brief
+		* Function that set the fraction of dead links over the links of the CSR snapshot
+		* that triggers its compaction
+		* Note: Thread Safe
+		*
+		* @param threshold The compaction threshold, between 0 and 1
+		*/
+        void setCompactionThreshold(double threshold) override;
+        /**
+		* \brief
+		* Function that return the number of dead links in the CSR snapshot
+		* Note: Thread Safe
+		*
+		* @returns the number of tombstones
+		*/
+        std::size_t getNumberOfTombstones() const override;
+        /**
+		* \brief
+		* Function that return the number of links added after the CSR snapshot was built
+		* Note: Thread Safe
+		*
+		* @returns the number of appended links
+		*/
+        std::size_t getNumberOfAppendedLinks() const override;
+        /**
+		* \brief
+		* Function that rebuild the CSR snapshot without the dead links and with the appended ones
+		* Note: Thread Safe
+		*/
+        void compact() override;
         /**
  		* @brief Function runs the dijkstra algorithm for some source node and
  		* target node in the graph and returns the shortest distance of target
@@ -110,6 +313,57 @@ namespace CXXGRAPH
  		* case if target is not reachable from source or there is error in the computation.
  		*/
         const DijkstraResult dijkstra(const Node<T> &source, const Node<T> &target) const override;
+        /**
+ 		* @brief Function runs the dijkstra algorithm from a source node to all the
+ 		* nodes of the graph and returns the shortest distances in a flat array.
+		* Note: Thread Safe
+ 		*
+		* @param source source vertex
+ 		*
+ 		* @return the distances and the predecessors of all the nodes, or ERROR
+		* in case of error in the computation.
+ 		*/
+        const DijkstraAllResult dijkstraAll(const Node<T> &source) const override;
+        /**
+ 		* @brief Function runs the bidirectional dijkstra algorithm between a source node
+ 		* and a target node.
+		* Note: Thread Safe
+ 		*
+		* @param source source vertex
+ 		* @param target target vertex
+ 		*
+ 		* @return shortest distance and path if target is reachable from source else ERROR in
+ 		* case if target is not reachable from source or there is error in the computation.
+ 		*/
+        const DijkstraResult bidirectionalDijkstra(const Node<T> &source, const Node<T> &target) const override;
+        /**
+ 		* @brief Function runs the A* algorithm between a source node and a target node,
+		* it hides the one of Graph, that a template can not override.
+		* Note: Thread Safe, the heuristic is called with the lock held
+ 		*
+		* @param source source vertex
+ 		* @param target target vertex
+		* @param heuristic The function called as heuristic(const Node<T> &node), returning the
+		* estimated distance from the node to the target
+ 		*
+ 		* @return shortest distance and path if target is reachable from source else ERROR in
+ 		* case if target is not reachable from source or there is error in the computation.
+ 		*/
+        template <typename Heuristic>
+        const DijkstraResult astar(const Node<T> &source, const Node<T> &target, Heuristic &&heuristic) const;
+        /**
+ 		* @brief Function runs the dijkstra algorithm from a batch of source nodes
+ 		* to a set of target nodes and returns the distance matrix.
+		* Note: Thread Safe
+ 		*
+		* @param sources source vertices
+		* @param targets target vertices
+		* @param numberOfThreads number of threads, 0 for the number of hardware threads
+ 		*
+ 		* @return the matrix of the distances of the targets from the sources, or ERROR
+		* in case of error in the computation.
+ 		*/
+        const DijkstraBatchResult dijkstraBatch(const std::vector<const Node<T> *> &sources, const std::vector<const Node<T> *> &targets, unsigned int numberOfThreads = 0) const override;
         /**
  		* \brief
  		* Function performs the breadth first search algorithm over the graph
@@ -189,6 +443,30 @@ namespace CXXGRAPH
  		* case there is error in the computation.
  		*/
         const DialResult dial(const Node<T> &source, int maxWeight) const override;
+        /**
+ 		* @brief Function runs the parallel Delta-Stepping algorithm for some source node and
+ 		* returns the shortest distance of all the nodes from the source.
+		* Note: Thread Safe
+ 		*
+		* @param source source vertex
+		* @param delta width of the buckets
+		* @param numberOfThreads number of threads, 0 to use the hardware concurrency
+ 		*
+ 		* @return shortest distance for all nodes reachable from source else ERROR in
+ 		* case there is error in the computation.
+ 		*/
+        const DeltaSteppingResult deltaStepping(const Node<T> &source, double delta, unsigned int numberOfThreads = 0) const override;
+        /**
+ 		* @brief Function runs the dijkstra algorithm with a radix heap for some source node and
+ 		* returns the shortest distance of all the nodes from the source.
+		* Note: Thread Safe
+ 		*
+		* @param source source vertex
+ 		*
+ 		* @return shortest distance for all nodes reachable from source else ERROR in
+ 		* case there is error in the computation, or an edge weight is negative.
+ 		*/
+        const DialResult radixDijkstra(const Node<T> &source) const override;
 
         /**
      	* \brief
@@ -230,6 +508,29 @@ namespace CXXGRAPH
 		* @return The partiton Map of the partitioned graph
      	*/
         PartitionMap<T> partitionGraph(PARTITIONING::PartitionAlgorithm algorithm, unsigned int numberOfPartitions) const override;
+        /**
+     	* \brief
+     	* This function return an immutable snapshot of the current version of the Graph.
+		* The snapshot is shared by all the readers of the same version and can be traversed
+		* without any lock, the writers never wait for it and never modify it.
+		* It is built, with all its caches, by the first call after a write.
+		* The versions share no adjacency blocks: the Edge list of the version is copied
+		* under the lock, O(E) pointer copies, and only the indexes and the snapshots
+		* are built after the lock is released. A write waits at most for that copy,
+		* and only when it meets a snapshot() that follows another write.
+		* Note: Thread Safe
+     	*
+		* @return The snapshot of the current version
+     	*/
+        std::shared_ptr<const Graph<T>> snapshot() const;
+        /**
+     	* \brief
+     	* This function return the version of the Graph, incremented by every write
+		* Note: Thread Safe
+     	*
+		* @return The current version
+     	*/
+        std::uint64_t getVersion() const;
     };
 
     template <typename T>
@@ -239,8 +540,12 @@ namespace CXXGRAPH
     Graph_TS<T>::Graph_TS(const Graph<T> &graph) : Graph<T>(graph), ThreadSafe() {}
 
     template <typename T>
-    const std::list<const Edge<T> *> &Graph_TS<T>::getEdgeSet() const
+    Graph_TS<T>::Graph_TS(Graph<T> &&graph) : Graph<T>(std::move(graph)), ThreadSafe() {}
+
+    template <typename T>
+    const std::list<const Edge<T> *> Graph_TS<T>::getEdgeSet() const
     {
+        // the copy is taken under the lock, a reference would be read by the caller without it
         std::lock_guard<std::mutex> lock(mutex);
         return Graph<T>::getEdgeSet();
     }
@@ -250,6 +555,7 @@ namespace CXXGRAPH
     {
         getLock();
         Graph<T>::setEdgeSet(edgeSet);
+        publishVersion();
         releaseLock();
     }
 
@@ -258,6 +564,36 @@ namespace CXXGRAPH
     {
         getLock();
         Graph<T>::addEdge(edge);
+        publishVersion();
+        releaseLock();
+    }
+
+    template <typename T>
+    const Edge<T> *Graph_TS<T>::addEdge(std::unique_ptr<const Edge<T>> edge)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto added = Graph<T>::addEdge(std::move(edge));
+        if (added)
+        {
+            // a rejected Edge leaves the current version and its snapshot valid
+            publishVersion();
+        }
+        return added;
+    }
+
+    template <typename T>
+    const Node<T> *Graph_TS<T>::createNode(unsigned long id, const T &data)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return Graph<T>::createNode(id, data);
+    }
+
+    template <typename T>
+    void Graph_TS<T>::addEdges(const std::vector<const Edge<T> *> &edges)
+    {
+        getLock();
+        Graph<T>::addEdges(edges);
+        publishVersion();
         releaseLock();
     }
 
@@ -266,6 +602,7 @@ namespace CXXGRAPH
     {
         getLock();
         Graph<T>::removeEdge(edgeId);
+        publishVersion();
         releaseLock();
     }
 
@@ -278,6 +615,60 @@ namespace CXXGRAPH
         return ns;
     }
 
+    template <typename T>
+    const std::optional<const Node<T> *> Graph_TS<T>::getNode(unsigned long nodeId) const
+    {
+        getLock();
+        auto n = Graph<T>::getNode(nodeId);
+        releaseLock();
+        return n;
+    }
+
+    template <typename T>
+    std::size_t Graph_TS<T>::getInDegree(const Node<T> &node) const
+    {
+        getLock();
+        auto inDegree = Graph<T>::getInDegree(node);
+        releaseLock();
+        return inDegree;
+    }
+
+    template <typename T>
+    const std::vector<const Node<T> *> Graph_TS<T>::getPredecessors(const Node<T> &node) const
+    {
+        getLock();
+        auto predecessors = Graph<T>::getPredecessors(node);
+        releaseLock();
+        return predecessors;
+    }
+
+    template <typename T>
+    bool Graph_TS<T>::hasEdge(const Node<T> &nodeFrom, const Node<T> &nodeTo) const
+    {
+        getLock();
+        auto result = Graph<T>::hasEdge(nodeFrom, nodeTo);
+        releaseLock();
+        return result;
+    }
+
+    template <typename T>
+    const std::vector<const Edge<T> *> Graph_TS<T>::getEdgesBetween(const Node<T> &nodeFrom, const Node<T> &nodeTo) const
+    {
+        getLock();
+        auto edges = Graph<T>::getEdgesBetween(nodeFrom, nodeTo);
+        releaseLock();
+        return edges;
+    }
+
+    template <typename T>
+    NeighborRange<T> Graph_TS<T>::neighbors(const Node<T> &node) const
+    {
+        getLock();
+        auto range = Graph<T>::neighbors(node);
+        releaseLock();
+        return range;
+    }
+
     template <typename T>
     const std::optional<const Edge<T> *> Graph_TS<T>::getEdge(unsigned long edgeId) const
     {
@@ -296,6 +687,101 @@ namespace CXXGRAPH
         return adjm;
     }
 
+    template <typename T>
+    const std::shared_ptr<const CompactGraph<T>> Graph_TS<T>::freeze() const
+    {
+        getLock();
+        auto compact = Graph<T>::freeze();
+        releaseLock();
+        return compact;
+    }
+
+    template <typename T>
+    const std::shared_ptr<const CompressedGraph<T>> Graph_TS<T>::freezeCompressed() const
+    {
+        getLock();
+        auto compressed = Graph<T>::freezeCompressed();
+        releaseLock();
+        return compressed;
+    }
+
+    template <typename T>
+    void Graph_TS<T>::setCompressedAdjacency(bool compressed)
+    {
+        getLock();
+        Graph<T>::setCompressedAdjacency(compressed);
+        releaseLock();
+    }
+
+    template <typename T>
+    bool Graph_TS<T>::isCompressedAdjacency() const
+    {
+        getLock();
+        auto compressed = Graph<T>::isCompressedAdjacency();
+        releaseLock();
+        return compressed;
+    }
+
+    template <typename T>
+    const std::shared_ptr<const EdgeColumns<T>> Graph_TS<T>::getEdgeColumns() const
+    {
+        getLock();
+        auto columns = Graph<T>::getEdgeColumns();
+        releaseLock();
+        return columns;
+    }
+
+    template <typename T>
+    const MemoryUsage Graph_TS<T>::memoryUsage() const
+    {
+        getLock();
+        auto usage = Graph<T>::memoryUsage();
+        releaseLock();
+        return usage;
+    }
+
+    template <typename T>
+    void Graph_TS<T>::setTombstoneRemoval(bool enabled)
+    {
+        getLock();
+        Graph<T>::setTombstoneRemoval(enabled);
+        releaseLock();
+    }
+
+    template <typename T>
+    void Graph_TS<T>::setCompactionThreshold(double threshold)
+    {
+        getLock();
+        Graph<T>::setCompactionThreshold(threshold);
+        releaseLock();
+    }
+
+    template <typename T>
+    std::size_t Graph_TS<T>::getNumberOfTombstones() const
+    {
+        getLock();
+        auto tombstones = Graph<T>::getNumberOfTombstones();
+        releaseLock();
+        return tombstones;
+    }
+
+    template <typename T>
+    std::size_t Graph_TS<T>::getNumberOfAppendedLinks() const
+    {
+        getLock();
+        auto appended = Graph<T>::getNumberOfAppendedLinks();
+        releaseLock();
+        return appended;
+    }
+
+    template <typename T>
+    void Graph_TS<T>::compact()
+    {
+        getLock();
+        Graph<T>::compact();
+        releaseLock();
+    }
+
     template <typename T>
     const DijkstraResult Graph_TS<T>::dijkstra(const Node<T> &source, const Node<T> &target) const
     {
@@ -305,6 +791,43 @@ namespace CXXGRAPH
         return dij;
     }
 
+    template <typename T>
+    const DijkstraResult Graph_TS<T>::bidirectionalDijkstra(const Node<T> &source, const Node<T> &target) const
+    {
+        getLock();
+        auto dij = Graph<T>::bidirectionalDijkstra(source, target);
+        releaseLock();
+        return dij;
+    }
+
+    template <typename T>
+    template <typename Heuristic>
+    const DijkstraResult Graph_TS<T>::astar(const Node<T> &source, const Node<T> &target, Heuristic &&heuristic) const
+    {
+        getLock();
+        auto dij = Graph<T>::astar(source, target, std::forward<Heuristic>(heuristic));
+        releaseLock();
+        return dij;
+    }
+
+    template <typename T>
+    const DijkstraAllResult Graph_TS<T>::dijkstraAll(const Node<T> &source) const
+    {
+        getLock();
+        auto dij = Graph<T>::dijkstraAll(source);
+        releaseLock();
+        return dij;
+    }
+
+    template <typename T>
+    const DijkstraBatchResult Graph_TS<T>::dijkstraBatch(const std::vector<const Node<T> *> &sources, const std::vector<const Node<T> *> &targets, unsigned int numberOfThreads) const
+    {
+        getLock();
+        auto dij = Graph<T>::dijkstraBatch(sources, targets, numberOfThreads);
+        releaseLock();
+        return dij;
+    }
+
     template <typename T>
     const std::vector<Node<T>> Graph_TS<T>::breadth_first_search(const Node<T> &start) const
     {
@@ -359,6 +882,24 @@ namespace CXXGRAPH
         return dial;
     }
 
+    template <typename T>
+    const DeltaSteppingResult Graph_TS<T>::deltaStepping(const Node<T> &source, double delta, unsigned int numberOfThreads) const
+    {
+        getLock();
+        auto deltaStepping = Graph<T>::deltaStepping(source, delta, numberOfThreads);
+        releaseLock();
+        return deltaStepping;
+    }
+
+    template <typename T>
+    const DialResult Graph_TS<T>::radixDijkstra(const Node<T> &source) const
+    {
+        getLock();
+        auto radixDijkstra = Graph<T>::radixDijkstra(source);
+        releaseLock();
+        return radixDijkstra;
+    }
+
     template <typename T>
     int Graph_TS<T>::writeToFile(InputOutputFormat format, const std::string &workingDir, const std::string &OFileName, bool compress, bool writeNodeFeat, bool writeEdgeWeight) const
     {
@@ -373,6 +914,7 @@ namespace CXXGRAPH
     {
         getLock();
         auto result = Graph<T>::readFromFile(format, workingDir, OFileName, compress, readNodeFeat, readEdgeWeight);
+        publishVersion();
         releaseLock();
         return result;
     }
@@ -385,5 +927,55 @@ namespace CXXGRAPH
         releaseLock();
         return partitions;
     }
+
+    template <typename T>
+    void Graph_TS<T>::publishVersion()
+    {
+        // called with the lock held: the readers of the old version keep their reference
+        currentSnapshot.reset();
+        version++;
+    }
+
+    template <typename T>
+    std::shared_ptr<const Graph<T>> Graph_TS<T>::snapshot() const
+    {
+        auto newSnapshot = std::make_shared<Graph<T>>();
+        std::uint64_t snapshotVersion;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (currentSnapshot)
+            {
+                return currentSnapshot;
+            }
+            // only the Edge list and the cached snapshots that are still valid are copied
+            // under the lock, the writers are not stalled by the indexes of the copy
+            newSnapshot->copyEdgeSet(*this);
+            snapshotVersion = version;
+        }
+        newSnapshot->indexEdgeSet();
+        // all the caches are built now, also the compressed one when the compressed mode is off,
+        // so the const readers of the snapshot never write to it
+        newSnapshot->freeze();
+        newSnapshot->getEdgeColumns();
+        newSnapshot->freezeCompressed();
+        std::lock_guard<std::mutex> lock(mutex);
+        if (version == snapshotVersion)
+        {
+            // a reader that built the same version first has already published its copy
+            if (currentSnapshot)
+            {
+                return currentSnapshot;
+            }
+            currentSnapshot = newSnapshot;
+        }
+        return newSnapshot;
+    }
+
+    template <typename T>
+    std::uint64_t Graph_TS<T>::getVersion() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return version;
+    }
 }
 #endif // __GRAPH_TS_H__
\ No newline at end of file
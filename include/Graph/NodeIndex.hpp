@@ -0,0 +1,162 @@
+/***********************************************************/
+/***      ______  ____  ______                 _         ***/
+/***     / ___\ \/ /\ \/ / ___|_ __ __ _ _ __ | |__	     ***/
+/***    | |    \  /  \  / |  _| '__/ _` | '_ \| '_ \	 ***/
+/***    | |___ /  \  /  \ |_| | | | (_| | |_) | | | |    ***/
+/***     \____/_/\_\/_/\_\____|_|  \__,_| .__/|_| |_|    ***/
+/***                                    |_|			     ***/
+/***********************************************************/
+/***     Header-Only C++ Library for Graph			     ***/
+/***	 Representation and Algorithms				     ***/
+/***********************************************************/
+/***     Author: ZigRazor			     			     ***/
+/***	 E-Mail: zigrazor@gmail.com 				     ***/
+/***********************************************************/
+/***	 Collaboration: ----------- 				     ***/
+/***********************************************************/
+/***	 License: AGPL v3.0							     ***/
+/***********************************************************/
+
+#ifndef __NODEINDEX_H__
+#define __NODEINDEX_H__
+
+#pragma once
+
+#include <vector>
+#include <optional>
+#include <unordered_map>
+
+#include "Node/Node.hpp"
+#include "Utility/Typedef.hpp"
+#include "Utility/MemoryUsage.hpp"
+
+namespace CXXGRAPH
+{
+	/// Class that map every Node to a dense index 0..V-1, in order of insertion.
+	/// Nodes are identified by their id. The dense index let the algorithms keep
+	/// their state in plain vectors instead of maps keyed by Node.
+	template <typename T>
+	class NodeIndex
+	{
+	private:
+		std::vector<const Node<T> *> nodes;
+		std::unordered_map<unsigned long, DenseIndex> indexMap;
+
+	public:
+		NodeIndex() = default;
+		~NodeIndex() = default;
+		/**
+		* \brief
+		* Function that reserve space for a number of Nodes
+		*
+		* @param numberOfNodes The number of Nodes
+		*/
+		void reserve(std::size_t numberOfNodes);
+		/**
+		* \brief
+		* Function that insert a Node, if a Node with the same id is not already present
+		*
+		* @param node The Node to insert
+		* @returns the dense index of the Node
+		*/
+		DenseIndex insert(const Node<T> *node);
+		/**
+		* \brief
+		* Function that return the dense index of a Node
+		*
+		* @param node The Node to search
+		* @returns the index of the Node if it is present
+		*/
+		const std::optional<DenseIndex> getIndex(const Node<T> &node) const;
+		/**
+		* \brief
+		* Function that return the dense index of the Node with a specific id
+		*
+		* @param nodeId The id of the Node to search
+		* @returns the index of the Node if it is present
+		*/
+		const std::optional<DenseIndex> getIndex(unsigned long nodeId) const;
+		/**
+		* \brief
+		* Function that return the Node with a specific dense index
+		*
+		* @param index The dense index of the Node
+		* @returns the Node
+		*/
+		const Node<T> *getNode(DenseIndex index) const;
+		/**
+		* \brief
+		* Function that return the number of indexed Nodes
+		*
+		* @returns the number of Nodes
+		*/
+		std::size_t size() const;
+		/**
+		* \brief
+		* Function that return an estimate of the memory used by the Node Index
+		*
+		* @returns the number of bytes
+		*/
+		std::size_t memoryUsage() const;
+	};
+
+	template <typename T>
+	void NodeIndex<T>::reserve(std::size_t numberOfNodes)
+	{
+		nodes.reserve(numberOfNodes);
+		indexMap.reserve(numberOfNodes);
+	}
+
+	template <typename T>
+	DenseIndex NodeIndex<T>::insert(const Node<T> *node)
+	{
+		auto result = indexMap.emplace(node->getId(), static_cast<DenseIndex>(nodes.size()));
+		if (result.second)
+		{
+			nodes.push_back(node);
+		}
+		return result.first->second;
+	}
+
+	template <typename T>
+	const std::optional<DenseIndex> NodeIndex<T>::getIndex(const Node<T> &node) const
+	{
+		auto it = indexMap.find(node.getId());
+		if (it != indexMap.end() && *(nodes[it->second]) == node)
+		{
+			return it->second;
+		}
+		return std::nullopt;
+	}
+
+	template <typename T>
+	const std::optional<DenseIndex> NodeIndex<T>::getIndex(unsigned long nodeId) const
+	{
+		auto it = indexMap.find(nodeId);
+		if (it != indexMap.end())
+		{
+			return it->second;
+		}
+		return std::nullopt;
+	}
+
+	template <typename T>
+	const Node<T> *NodeIndex<T>::getNode(DenseIndex index) const
+	{
+		return nodes[index];
+	}
+
+	template <typename T>
+	std::size_t NodeIndex<T>::size() const
+	{
+		return nodes.size();
+	}
+
+	template <typename T>
+	std::size_t NodeIndex<T>::memoryUsage() const
+	{
+		return CXXGRAPH::memoryUsage(nodes) + CXXGRAPH::memoryUsage(indexMap);
+	}
+}
+
+#endif // __NODEINDEX_H__
@@ -25,11 +25,12 @@
 #include <list>
 
 #include "Utility/Typedef.hpp"
+#include "Utility/MemoryUsage.hpp"
 #include "PartitioningStats.hpp"
 
 namespace CXXGRAPH
 {
-    template <typename T>
+    template <typename T, typename Policy>
     class Graph;
     namespace PARTITIONING
     {
@@ -149,6 +150,17 @@ namespace CXXGRAPH
         template <typename T>
         static unsigned int getNumberOfReplicatedNodes(const PartitionMap<T> &partitionMap);
 
+        /**
+ 	    * @brief Estimate the memory used by the Partitions of the Partioned Graph.
+	    * The Edge and Node objects are shared with the original Graph, so they are not counted.
+ 	    *
+	    * @param partitionMap the Partition Map
+	    *
+	    * @return The memory usage in bytes
+ 	    */
+        template <typename T>
+        static MemoryUsage getPartitionMapMemoryUsage(const PartitionMap<T> &partitionMap);
+
         template <typename T>
         Partition<T>::Partition() : Graph<T>()
         {
@@ -185,6 +197,26 @@ namespace CXXGRAPH
             this->partitionId = partitionId;
         }
 
+        template <typename T>
+        MemoryUsage getPartitionMapMemoryUsage(const PartitionMap<T> &partitionMap)
+        {
+            MemoryUsage result;
+            result.graph = CXXGRAPH::memoryUsage(partitionMap);
+            for (const auto &partition : partitionMap)
+            {
+                auto usage = partition.second->memoryUsage();
+                result.graph += sizeof(Partition<T>);
+                result.edgeSet += usage.edgeSet;
+                result.nodeSet += usage.nodeSet;
+                result.indexes += usage.indexes;
+                result.adjacencyMatrix += usage.adjacencyMatrix;
+                result.snapshots += usage.snapshots;
+                result.arena += usage.arena;
+            }
+            result.total = result.graph + result.edgeSet + result.nodeSet + result.indexes + result.adjacencyMatrix + result.snapshots + result.arena;
+            return result;
+        }
+
         template <typename T>
         PartitioningStats getPartitionStats(const PartitionMap<T> &partitionMap)
         {
@@ -0,0 +1,197 @@
+/***********************************************************/
+/***      ______  ____  ______                 _         ***/
+/***     / ___\ \/ /\ \/ / ___|_ __ __ _ _ __ | |__	     ***/
+/***    | |    \  /  \  / |  _| '__/ _` | '_ \| '_ \	 ***/
+/***    | |___ /  \  /  \ |_| | | | (_| | |_) | | | |    ***/
+/***     \____/_/\_\/_/\_\____|_|  \__,_| .__/|_| |_|    ***/
+/***                                    |_|			     ***/
+/***********************************************************/
+/***     Header-Only C++ Library for Graph			     ***/
+/***	 Representation and Algorithms				     ***/
+/***********************************************************/
+/***     Author: ZigRazor			     			     ***/
+/***	 E-Mail: zigrazor@gmail.com 				     ***/
+/***********************************************************/
+/***	 Collaboration: ----------- 				     ***/
+/***********************************************************/
+/***	 License: AGPL v3.0							     ***/
+/***********************************************************/
+
+#ifndef __CXXGRAPH_ARENA_H__
+#define __CXXGRAPH_ARENA_H__
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <utility>
+#include <cstdint>
+#include <algorithm>
+#include <type_traits>
+#include <new>
+
+#include "Utility/ConstValue.hpp"
+
+namespace CXXGRAPH
+{
+	/// Class that implement a bump allocator for the Nodes and the Edges created by the Graph.
+	/// Objects are carved from large blocks and are all destroyed and released together
+	/// when the Arena is destroyed or released. ( This class is not Thread Safe )
+	class Arena
+	{
+	private:
+		struct Destructor
+		{
+			void *object;
+			void (*destroy)(void *);
+		};
+		std::size_t blockSize;
+		std::vector<std::unique_ptr<unsigned char[]>> blocks;
+		std::vector<Destructor> destructors;
+		unsigned char *current = nullptr;
+		std::size_t remaining = 0;
+		std::size_t allocatedBytes = 0;
+		std::size_t reservedBytes = 0;
+
+	public:
+		explicit Arena(std::size_t blockSize = DEFAULT_ARENA_BLOCK_SIZE);
+		Arena(const Arena &arena) = delete;
+		Arena &operator=(const Arena &arena) = delete;
+		~Arena();
+		/**
+		* \brief
+		* Function that allocate raw memory from the Arena
+		*
+		* @param size The number of bytes
+		* @param alignment The alignment of the memory ( must be a power of 2 )
+		* @returns a pointer to the memory, valid until the Arena is released
+		*/
+		void *allocate(std::size_t size, std::size_t alignment);
+		/**
+		* \brief
+		* Function that construct an object inside the Arena
+		*
+		* @param args The arguments of the constructor
+		* @returns a pointer to the object, valid until the Arena is released
+		*/
+		template <typename U, typename... Args>
+		U *create(Args &&...args);
+		/**
+		* \brief
+		* Function that take the ownership of an object allocated on the heap.
+		* The object is deleted when the Arena is released
+		*
+		* @param object The object to adopt
+		* @returns a pointer to the object, valid until the Arena is released
+		*/
+		template <typename U>
+		U *adopt(std::unique_ptr<U> object);
+		/**
+		* \brief
+		* Function that destroy all the objects and release all the memory of the Arena
+		*/
+		void release();
+		/**
+		* \brief
+		* Function that return the number of bytes handed out by the Arena
+		*
+		* @returns the allocated bytes
+		*/
+		std::size_t getAllocatedBytes() const;
+		/**
+		* \brief
+		* Function that return the number of bytes reserved by the Arena blocks
+		*
+		* @returns the reserved bytes
+		*/
+		std::size_t getReservedBytes() const;
+	};
+
+	//inline because the implementation of non-template function in header file
+	inline Arena::Arena(std::size_t blockSize) : blockSize(blockSize) {}
+
+	//inline because the implementation of non-template function in header file
+	inline Arena::~Arena()
+	{
+		release();
+	}
+
+	//inline because the implementation of non-template function in header file
+	inline void *Arena::allocate(std::size_t size, std::size_t alignment)
+	{
+		std::size_t padding = (alignment - reinterpret_cast<std::uintptr_t>(current) % alignment) % alignment;
+		if (current == nullptr || padding + size > remaining)
+		{
+			// objects bigger than a block get a dedicated block
+			std::size_t newBlockSize = std::max(blockSize, size + alignment);
+			blocks.emplace_back(new unsigned char[newBlockSize]);
+			current = blocks.back().get();
+			remaining = newBlockSize;
+			reservedBytes += newBlockSize;
+			padding = (alignment - reinterpret_cast<std::uintptr_t>(current) % alignment) % alignment;
+		}
+		void *result = current + padding;
+		current += padding + size;
+		remaining -= padding + size;
+		allocatedBytes += size;
+		return result;
+	}
+
+	template <typename U, typename... Args>
+	U *Arena::create(Args &&...args)
+	{
+		void *memory = allocate(sizeof(U), alignof(U));
+		U *object = new (memory) U(std::forward<Args>(args)...);
+		if (!std::is_trivially_destructible<U>::value)
+		{
+			destructors.push_back({object, [](void *ptr)
+								   { static_cast<U *>(ptr)->~U(); }});
+		}
+		return object;
+	}
+
+	template <typename U>
+	U *Arena::adopt(std::unique_ptr<U> object)
+	{
+		U *result = object.get();
+		if (result != nullptr)
+		{
+			// the destructor is recorded before the release, so the object is not leaked if push_back throws
+			destructors.push_back({const_cast<std::remove_const_t<U> *>(result), [](void *ptr)
+								   { delete static_cast<U *>(ptr); }});
+			object.release();
+		}
+		return result;
+	}
+
+	//inline because the implementation of non-template function in header file
+	inline void Arena::release()
+	{
+		// destroy in reverse order, Edges are created after the Nodes they refer to
+		for (auto it = destructors.rbegin(); it != destructors.rend(); ++it)
+		{
+			it->destroy(it->object);
+		}
+		destructors.clear();
+		blocks.clear();
+		current = nullptr;
+		remaining = 0;
+		allocatedBytes = 0;
+		reservedBytes = 0;
+	}
+
+	//inline because the implementation of non-template function in header file
+	inline std::size_t Arena::getAllocatedBytes() const
+	{
+		return allocatedBytes;
+	}
+
+	//inline because the implementation of non-template function in header file
+	inline std::size_t Arena::getReservedBytes() const
+	{
+		return reservedBytes;
+	}
+}
+
+#endif // __CXXGRAPH_ARENA_H__
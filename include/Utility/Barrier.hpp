@@ -0,0 +1,92 @@
+/***********************************************************/
+/***      ______  ____  ______                 _         ***/
+/***     / ___\ \/ /\ \/ / ___|_ __ __ _ _ __ | |__	     ***/
+/***    | |    \  /  \  / |  _| '__/ _` | '_ \| '_ \	 ***/
+/***    | |___ /  \  /  \ |_| | | | (_| | |_) | | | |    ***/
+/***     \____/_/\_\/_/\_\____|_|  \__,_| .__/|_| |_|    ***/
+/***                                    |_|			     ***/
+/***********************************************************/
+/***     Header-Only C++ Library for Graph			     ***/
+/***	 Representation and Algorithms				     ***/
+/***********************************************************/
+/***     Author: ZigRazor			     			     ***/
+/***	 E-Mail: zigrazor@gmail.com 				     ***/
+/***********************************************************/
+/***	 Collaboration: ----------- 				     ***/
+/***********************************************************/
+/***	 License: AGPL v3.0							     ***/
+/***********************************************************/
+
+#ifndef __CXXGRAPH_BARRIER_H__
+#define __CXXGRAPH_BARRIER_H__
+
+#pragma once
+
+#include <mutex>
+#include <cstddef>
+#include <condition_variable>
+
+namespace CXXGRAPH
+{
+	/// Class that implement a reusable barrier for a fixed number of threads.
+	/// The last thread that arrive run a completion function before the others are
+	/// released, so the serial step between two parallel phases needs no other lock.
+	class Barrier
+	{
+	private:
+		std::mutex mutex;
+		std::condition_variable condition;
+		const std::size_t numberOfThreads;
+		std::size_t waiting = 0;
+		std::size_t generation = 0;
+
+	public:
+		explicit Barrier(std::size_t numberOfThreads);
+		~Barrier() = default;
+		Barrier(const Barrier &) = delete;
+		Barrier &operator=(const Barrier &) = delete;
+		/**
+		* \brief
+		* Function that block until all the threads have arrived at the barrier.
+		* The completion function is called by the last thread, while the others wait.
+		*
+		* @param completion The function called as completion()
+		*/
+		template <typename Completion>
+		void arriveAndWait(Completion &&completion);
+		/**
+		* \brief
+		* Function that block until all the threads have arrived at the barrier
+		*/
+		void arriveAndWait();
+	};
+
+	//inline because the implementation of non-template function in header file
+	inline Barrier::Barrier(std::size_t numberOfThreads) : numberOfThreads(numberOfThreads) {}
+
+	template <typename Completion>
+	void Barrier::arriveAndWait(Completion &&completion)
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		if (++waiting == numberOfThreads)
+		{
+			completion();
+			waiting = 0;
+			++generation;
+			condition.notify_all();
+			return;
+		}
+		// the generation tells a new phase apart from a spurious wakeup
+		auto arrivedIn = generation;
+		condition.wait(lock, [this, arrivedIn]()
+					   { return generation != arrivedIn; });
+	}
+
+	//inline because the implementation of non-template function in header file
+	inline void Barrier::arriveAndWait()
+	{
+		arriveAndWait([]() {});
+	}
+}
+
+#endif // __CXXGRAPH_BARRIER_H__
@@ -30,6 +30,8 @@ namespace CXXGRAPH
 	constexpr char ERR_TARGET_NODE_NOT_REACHABLE[] = "Target Node not Reachable";
 	constexpr char ERR_TARGET_NODE_NOT_IN_GRAPH[] = "Target Node not inside Graph";
 	constexpr char ERR_SOURCE_NODE_NOT_IN_GRAPH[] = "Source Node not inside Graph";
+	constexpr char ERR_WEIGHT_OUT_OF_RANGE[] = "Edge weight out of range";
+	constexpr char ERR_DELTA_NOT_POSITIVE[] = "Delta is not positive";
 	///////////////////////////////
 }
 #endif // __CONSTSTRING_H__
\ No newline at end of file
@@ -23,10 +23,15 @@
 #pragma once
 
 #include <limits>
+#include <cstddef>
 
 namespace CXXGRAPH
 {
     constexpr double INF_DOUBLE = std::numeric_limits<double>::max();
+    /// Size of the blocks of the Arena used by the Graph to allocate Nodes and Edges
+    constexpr std::size_t DEFAULT_ARENA_BLOCK_SIZE = 64 * 1024;
+    /// Fraction of removed links over the links of the CSR snapshot that triggers its compaction
+    constexpr double DEFAULT_COMPACTION_THRESHOLD = 0.25;
 }
 
 #endif // __CONSTVALUE_H__
\ No newline at end of file
@@ -0,0 +1,239 @@
+/***********************************************************/
+/***      ______  ____  ______                 _         ***/
+/***     / ___\ \/ /\ \/ / ___|_ __ __ _ _ __ | |__	     ***/
+/***    | |    \  /  \  / |  _| '__/ _` | '_ \| '_ \	 ***/
+/***    | |___ /  \  /  \ |_| | | | (_| | |_) | | | |    ***/
+/***     \____/_/\_\/_/\_\____|_|  \__,_| .__/|_| |_|    ***/
+/***                                    |_|			     ***/
+/***********************************************************/
+/***     Header-Only C++ Library for Graph			     ***/
+/***	 Representation and Algorithms				     ***/
+/***********************************************************/
+/***     Author: ZigRazor			     			     ***/
+/***	 E-Mail: zigrazor@gmail.com 				     ***/
+/***********************************************************/
+/***	 Collaboration: ----------- 				     ***/
+/***********************************************************/
+/***	 License: AGPL v3.0							     ***/
+/***********************************************************/
+
+#ifndef __CXXGRAPH_INDEXEDHEAP_H__
+#define __CXXGRAPH_INDEXEDHEAP_H__
+
+#pragma once
+
+#include <vector>
+#include <limits>
+#include <utility>
+#include <cstddef>
+
+#include "Utility/Typedef.hpp"
+
+namespace CXXGRAPH
+{
+	/// Class that implement a min heap of the dense indices 0..N-1 with Arity children per node.
+	/// Every index is at most once in the heap and its position is tracked, so the key of an
+	/// index already in the heap can be decreased in place instead of pushing a duplicate.
+	/// A 4-ary heap is shallower than a binary one and its children share a cache line.
+	template <typename Key, std::size_t Arity = 4>
+	class IndexedHeap
+	{
+		static_assert(Arity >= 2, "the heap needs at least 2 children per node");
+
+	private:
+		static constexpr std::size_t NOT_IN_HEAP = std::numeric_limits<std::size_t>::max();
+		std::vector<std::pair<Key, DenseIndex>> heap;
+		std::vector<std::size_t> position;
+		void siftUp(std::size_t slot);
+		void siftDown(std::size_t slot);
+		void place(std::size_t slot, const std::pair<Key, DenseIndex> &entry);
+
+	public:
+		explicit IndexedHeap(std::size_t numberOfIndices = 0);
+		~IndexedHeap() = default;
+		/**
+		* \brief
+		* Function that resize the heap for the indices 0..N-1 and remove all the entries
+		*
+		* @param numberOfIndices The number of indices N
+		*/
+		void reset(std::size_t numberOfIndices);
+		/**
+		* \brief
+		* Function that remove all the entries, in time proportional to their number
+		*/
+		void clear();
+		/**
+		* \brief
+		* Function that insert an index, or decrease its key if it is already in the heap
+		*
+		* @param index The index
+		* @param key The new key
+		* @returns true if the index has been inserted or its key decreased
+		*/
+		bool pushOrDecrease(DenseIndex index, Key key);
+		/**
+		* \brief
+		* Function that return the index with the minimum key
+		*
+		* @returns the minimum key and its index
+		*/
+		const std::pair<Key, DenseIndex> &top() const;
+		/**
+		* \brief
+		* Function that remove the index with the minimum key
+		*
+		* @returns the minimum key and its index
+		*/
+		std::pair<Key, DenseIndex> pop();
+		/**
+		* \brief
+		* Function that check if an index is in the heap
+		*
+		* @param index The index
+		* @returns true if the index is in the heap
+		*/
+		bool contains(DenseIndex index) const;
+		bool empty() const;
+		std::size_t size() const;
+	};
+
+	template <typename Key, std::size_t Arity>
+	IndexedHeap<Key, Arity>::IndexedHeap(std::size_t numberOfIndices) : position(numberOfIndices, NOT_IN_HEAP) {}
+
+	template <typename Key, std::size_t Arity>
+	void IndexedHeap<Key, Arity>::reset(std::size_t numberOfIndices)
+	{
+		heap.clear();
+		position.assign(numberOfIndices, NOT_IN_HEAP);
+	}
+
+	template <typename Key, std::size_t Arity>
+	void IndexedHeap<Key, Arity>::clear()
+	{
+		for (const auto &entry : heap)
+		{
+			position[entry.second] = NOT_IN_HEAP;
+		}
+		heap.clear();
+	}
+
+	template <typename Key, std::size_t Arity>
+	void IndexedHeap<Key, Arity>::place(std::size_t slot, const std::pair<Key, DenseIndex> &entry)
+	{
+		heap[slot] = entry;
+		position[entry.second] = slot;
+	}
+
+	template <typename Key, std::size_t Arity>
+	void IndexedHeap<Key, Arity>::siftUp(std::size_t slot)
+	{
+		// move the parents down until the hole reaches the place of the entry
+		auto entry = heap[slot];
+		while (slot > 0)
+		{
+			std::size_t parent = (slot - 1) / Arity;
+			if (!(entry.first < heap[parent].first))
+			{
+				break;
+			}
+			place(slot, heap[parent]);
+			slot = parent;
+		}
+		place(slot, entry);
+	}
+
+	template <typename Key, std::size_t Arity>
+	void IndexedHeap<Key, Arity>::siftDown(std::size_t slot)
+	{
+		auto entry = heap[slot];
+		const std::size_t heapSize = heap.size();
+		while (true)
+		{
+			std::size_t firstChild = slot * Arity + 1;
+			if (firstChild >= heapSize)
+			{
+				break;
+			}
+			std::size_t lastChild = firstChild + Arity < heapSize ? firstChild + Arity : heapSize;
+			std::size_t minChild = firstChild;
+			for (std::size_t child = firstChild + 1; child < lastChild; ++child)
+			{
+				if (heap[child].first < heap[minChild].first)
+				{
+					minChild = child;
+				}
+			}
+			if (!(heap[minChild].first < entry.first))
+			{
+				break;
+			}
+			place(slot, heap[minChild]);
+			slot = minChild;
+		}
+		place(slot, entry);
+	}
+
+	template <typename Key, std::size_t Arity>
+	bool IndexedHeap<Key, Arity>::pushOrDecrease(DenseIndex index, Key key)
+	{
+		std::size_t slot = position[index];
+		if (slot == NOT_IN_HEAP)
+		{
+			heap.emplace_back(key, index);
+			siftUp(heap.size() - 1);
+			return true;
+		}
+		if (key < heap[slot].first)
+		{
+			heap[slot].first = key;
+			siftUp(slot);
+			return true;
+		}
+		return false;
+	}
+
+	template <typename Key, std::size_t Arity>
+	const std::pair<Key, DenseIndex> &IndexedHeap<Key, Arity>::top() const
+	{
+		return heap.front();
+	}
+
+	template <typename Key, std::size_t Arity>
+	std::pair<Key, DenseIndex> IndexedHeap<Key, Arity>::pop()
+	{
+		auto result = heap.front();
+		position[result.second] = NOT_IN_HEAP;
+		if (heap.size() > 1)
+		{
+			heap.front() = heap.back();
+			heap.pop_back();
+			siftDown(0);
+		}
+		else
+		{
+			heap.pop_back();
+		}
+		return result;
+	}
+
+	template <typename Key, std::size_t Arity>
+	bool IndexedHeap<Key, Arity>::contains(DenseIndex index) const
+	{
+		return position[index] != NOT_IN_HEAP;
+	}
+
+	template <typename Key, std::size_t Arity>
+	bool IndexedHeap<Key, Arity>::empty() const
+	{
+		return heap.empty();
+	}
+
+	template <typename Key, std::size_t Arity>
+	std::size_t IndexedHeap<Key, Arity>::size() const
+	{
+		return heap.size();
+	}
+}
+
+#endif // __CXXGRAPH_INDEXEDHEAP_H__
@@ -0,0 +1,79 @@
+/***********************************************************/
+/***      ______  ____  ______                 _         ***/
+/***     / ___\ \/ /\ \/ / ___|_ __ __ _ _ __ | |__	     ***/
+/***    | |    \  /  \  / |  _| '__/ _` | '_ \| '_ \	 ***/
+/***    | |___ /  \  /  \ |_| | | | (_| | |_) | | | |    ***/
+/***     \____/_/\_\/_/\_\____|_|  \__,_| .__/|_| |_|    ***/
+/***                                    |_|			     ***/
+/***********************************************************/
+/***     Header-Only C++ Library for Graph			     ***/
+/***	 Representation and Algorithms				     ***/
+/***********************************************************/
+/***     Author: ZigRazor			     			     ***/
+/***	 E-Mail: zigrazor@gmail.com 				     ***/
+/***********************************************************/
+/***	 Collaboration: ----------- 				     ***/
+/***********************************************************/
+/***	 License: AGPL v3.0							     ***/
+/***********************************************************/
+
+#ifndef __CXXGRAPH_MEMORYUSAGE_H__
+#define __CXXGRAPH_MEMORYUSAGE_H__
+
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <map>
+#include <vector>
+#include <unordered_map>
+
+namespace CXXGRAPH
+{
+	// Estimates of the memory used by the standard containers. The node layouts are the ones of
+	// the common implementations: two links for a list node, one link for a hash node, three links
+	// and a color for a tree node, plus the payload rounded up to the pointer alignment.
+
+	/// Function that round a size up to the alignment of the heap allocations
+	constexpr std::size_t alignedSize(std::size_t size)
+	{
+		return (size + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+	}
+
+	/// Function that estimate the memory used by the nodes of a std::list
+	template <typename V>
+	std::size_t memoryUsage(const std::list<V> &list)
+	{
+		return list.size() * alignedSize(2 * sizeof(void *) + sizeof(V));
+	}
+
+	/// Function that estimate the memory used by the buffer of a std::vector
+	template <typename V>
+	std::size_t memoryUsage(const std::vector<V> &vector)
+	{
+		return vector.capacity() * sizeof(V);
+	}
+
+	/// Function that estimate the memory used by the nodes of a std::map, not their mapped values
+	template <typename K, typename V>
+	std::size_t memoryUsage(const std::map<K, V> &map)
+	{
+		return map.size() * alignedSize(4 * sizeof(void *) + sizeof(std::pair<const K, V>));
+	}
+
+	/// Function that estimate the memory used by the buckets and the nodes of a std::unordered_map
+	template <typename K, typename V>
+	std::size_t memoryUsage(const std::unordered_map<K, V> &map)
+	{
+		return map.bucket_count() * sizeof(void *) + map.size() * alignedSize(sizeof(void *) + sizeof(std::pair<const K, V>));
+	}
+
+	/// Function that estimate the memory used by the buckets and the nodes of a std::unordered_multimap
+	template <typename K, typename V, typename Hash>
+	std::size_t memoryUsage(const std::unordered_multimap<K, V, Hash> &map)
+	{
+		return map.bucket_count() * sizeof(void *) + map.size() * alignedSize(sizeof(void *) + sizeof(std::pair<const K, V>));
+	}
+}
+
+#endif // __CXXGRAPH_MEMORYUSAGE_H__
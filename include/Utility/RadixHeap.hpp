@@ -0,0 +1,166 @@
+/***********************************************************/
+/***      ______  ____  ______                 _         ***/
+/***     / ___\ \/ /\ \/ / ___|_ __ __ _ _ __ | |__	     ***/
+/***    | |    \  /  \  / |  _| '__/ _` | '_ \| '_ \	 ***/
+/***    | |___ /  \  /  \ |_| | | | (_| | |_) | | | |    ***/
+/***     \____/_/\_\/_/\_\____|_|  \__,_| .__/|_| |_|    ***/
+/***                                    |_|			     ***/
+/***********************************************************/
+/***     Header-Only C++ Library for Graph			     ***/
+/***	 Representation and Algorithms				     ***/
+/***********************************************************/
+/***     Author: ZigRazor			     			     ***/
+/***	 E-Mail: zigrazor@gmail.com 				     ***/
+/***********************************************************/
+/***	 Collaboration: ----------- 				     ***/
+/***********************************************************/
+/***	 License: AGPL v3.0							     ***/
+/***********************************************************/
+
+#ifndef __CXXGRAPH_RADIXHEAP_H__
+#define __CXXGRAPH_RADIXHEAP_H__
+
+#pragma once
+
+#include <array>
+#include <vector>
+#include <limits>
+#include <utility>
+#include <cstddef>
+#include <type_traits>
+
+#include "Utility/Typedef.hpp"
+
+namespace CXXGRAPH
+{
+	/// Class that implement a monotone min heap of dense indices with unsigned integer keys.
+	/// The pushed keys must not be lower than the last popped one, as in Dijkstra.
+	/// An entry is in the bucket of the highest bit where its key differs from the last popped
+	/// key, so a pop moves every entry to a lower bucket at most once per bit of the key:
+	/// O(log C) amortized per entry, for keys no greater than the last popped one plus C.
+	/// An index can be pushed more than once, the stale entries are skipped by the caller.
+	template <typename Key = unsigned long>
+	class RadixHeap
+	{
+		static_assert(std::is_integral<Key>::value && std::is_unsigned<Key>::value, "the keys of the radix heap are unsigned integers");
+
+	private:
+		static constexpr std::size_t BITS = std::numeric_limits<Key>::digits;
+		std::array<std::vector<std::pair<Key, DenseIndex>>, BITS + 1> buckets;
+		Key last = 0;
+		std::size_t count = 0;
+		std::size_t bucketOf(Key key) const;
+
+	public:
+		RadixHeap() = default;
+		~RadixHeap() = default;
+		/**
+		* \brief
+		* Function that insert an index with a key
+		*
+		* @param key The key, not lower than the last popped key
+		* @param index The index
+		*/
+		void push(Key key, DenseIndex index);
+		/**
+		* \brief
+		* Function that remove the index with the minimum key
+		*
+		* @returns the minimum key and its index
+		*/
+		std::pair<Key, DenseIndex> pop();
+		/**
+		* \brief
+		* Function that remove all the entries and restart the keys from 0
+		*/
+		void clear();
+		bool empty() const;
+		std::size_t size() const;
+	};
+
+	template <typename Key>
+	std::size_t RadixHeap<Key>::bucketOf(Key key) const
+	{
+		// 0 for the last popped key, else 1 + the position of the highest differing bit
+		Key difference = key ^ last;
+#if defined(__GNUC__) || defined(__clang__)
+		if (difference == 0)
+		{
+			return 0;
+		}
+		return std::numeric_limits<unsigned long long>::digits - static_cast<std::size_t>(__builtin_clzll(static_cast<unsigned long long>(difference)));
+#else
+		std::size_t bucket = 0;
+		while (difference != 0)
+		{
+			++bucket;
+			difference >>= 1;
+		}
+		return bucket;
+#endif
+	}
+
+	template <typename Key>
+	void RadixHeap<Key>::push(Key key, DenseIndex index)
+	{
+		buckets[bucketOf(key)].emplace_back(key, index);
+		++count;
+	}
+
+	template <typename Key>
+	std::pair<Key, DenseIndex> RadixHeap<Key>::pop()
+	{
+		if (buckets[0].empty())
+		{
+			// the minimum of the first non-empty bucket become the last key, the other entries
+			// of the bucket differ from it in a lower bit and go to a lower bucket
+			std::size_t bucket = 1;
+			while (buckets[bucket].empty())
+			{
+				++bucket;
+			}
+			last = buckets[bucket].front().first;
+			for (const auto &entry : buckets[bucket])
+			{
+				if (entry.first < last)
+				{
+					last = entry.first;
+				}
+			}
+			for (const auto &entry : buckets[bucket])
+			{
+				buckets[bucketOf(entry.first)].push_back(entry);
+			}
+			buckets[bucket].clear();
+		}
+		auto result = buckets[0].back();
+		buckets[0].pop_back();
+		--count;
+		return result;
+	}
+
+	template <typename Key>
+	void RadixHeap<Key>::clear()
+	{
+		for (auto &bucket : buckets)
+		{
+			bucket.clear();
+		}
+		last = 0;
+		count = 0;
+	}
+
+	template <typename Key>
+	bool RadixHeap<Key>::empty() const
+	{
+		return count == 0;
+	}
+
+	template <typename Key>
+	std::size_t RadixHeap<Key>::size() const
+	{
+		return count;
+	}
+}
+
+#endif // __CXXGRAPH_RADIXHEAP_H__
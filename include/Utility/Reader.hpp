@@ -22,6 +22,8 @@
 
 #pragma once   // This is to make sure that this header is only included once
 
+#include "Utility/Typedef.hpp"
+
 namespace CXXGRAPH
 {
     /*!
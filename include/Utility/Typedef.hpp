@@ -25,6 +25,9 @@
 #include <map>
 #include <string>
 #include <fstream>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
 
 namespace CXXGRAPH
 {
@@ -52,6 +55,16 @@ namespace CXXGRAPH
 
 	typedef E_InputOutputFormat InputOutputFormat;
 
+	/// Specify the kind of Edges accepted by a Graph, see GraphPolicy
+	enum E_GraphKind
+	{
+		MIXED_GRAPH,	 ///< Directed and Undirected Edges
+		DIRECTED_GRAPH,	 ///< Only Directed Edges
+		UNDIRECTED_GRAPH ///< Only Undirected Edges
+	};
+
+	typedef E_GraphKind GraphKind;
+
 	
 
     /////////////////////////////////////////////////////
@@ -63,18 +76,77 @@ namespace CXXGRAPH
 		bool success;			  // TRUE if the function does not return error, FALSE otherwise
 		std::string errorMessage; //message of error
 		double result;			  //result (valid only if success is TRUE)
+		std::vector<unsigned long> path; //the ids of the Nodes of the shortest path, from source to target (valid only if success is TRUE)
 	};
 	typedef DijkstraResult_struct DijkstraResult;
 
-	/// Struct that contains the information about Dijsktra's Algorithm results
+	/// Struct that contains the information about Dijsktra's Algorithm results from a source to all the Nodes
+	struct DijkstraAllResult_struct
+	{
+		bool success;					   // TRUE if the function does not return error, FALSE otherwise
+		std::string errorMessage;		   //message of error
+		std::vector<unsigned long> nodeIds; //the ids of the Nodes, the other vectors are indexed in the same way
+		std::vector<double> distances;	   //the minimum distance of every Node from the source, INF_DOUBLE if not reachable (valid only if success is TRUE)
+		std::vector<std::size_t> predecessors; //the position of the previous Node on the shortest path, the position of the Node itself for the source and the unreachable Nodes (valid only if success is TRUE)
+	};
+	typedef DijkstraAllResult_struct DijkstraAllResult;
+
+	/// Struct that contains the information about Dijsktra's Algorithm results from a batch of sources to a set of targets
+	struct DijkstraBatchResult_struct
+	{
+		bool success;				   // TRUE if the function does not return error, FALSE otherwise
+		std::string errorMessage;	   //message of error
+		std::size_t numberOfTargets = 0; //the number of columns of the distance matrix
+		std::vector<double> distances; //row-major matrix, the distance of target j from source i is in i * numberOfTargets + j, INF_DOUBLE if not reachable (valid only if success is TRUE)
+	};
+	typedef DijkstraBatchResult_struct DijkstraBatchResult;
+
+	/// Struct that contains the information about Dial's Algorithm results
 	struct DialResult_struct
 	{
-		bool success;								  // TRUE if the function does not return error, FALSE otherwise
-		std::string errorMessage;					  //message of error
-		std::map<unsigned long, long> minDistanceMap; //result a map that contains the node id and the minumum distance from source (valid only if success is TRUE)
+		bool success;						// TRUE if the function does not return error, FALSE otherwise
+		std::string errorMessage;			//message of error
+		std::vector<unsigned long> nodeIds; //the ids of the Nodes, the distances are indexed in the same way
+		std::vector<long> distances;		//the minimum distance of every Node from the source, std::numeric_limits<long>::max() if not reachable (valid only if success is TRUE)
 	};
 	typedef DialResult_struct DialResult;
 
+	/// Struct that contains the information about Delta-Stepping Algorithm results
+	struct DeltaSteppingResult_struct
+	{
+		bool success;						// TRUE if the function does not return error, FALSE otherwise
+		std::string errorMessage;			//message of error
+		std::vector<unsigned long> nodeIds; //the ids of the Nodes, the distances are indexed in the same way
+		std::vector<double> distances;		//the minimum distance of every Node from the source, INF_DOUBLE if not reachable (valid only if success is TRUE)
+	};
+	typedef DeltaSteppingResult_struct DeltaSteppingResult;
+
+	/// Struct that describe at compile time the Edges of a Graph. A Graph with a restricted policy
+	/// refuses the Edges that do not match it, so the algorithms can drop the runtime checks.
+	template <typename W = double, GraphKind K = GraphKind::MIXED_GRAPH, bool AllWeighted = false>
+	struct GraphPolicy
+	{
+		using Weight = W;								  // type of the weights stored in the snapshots of the Graph
+		static constexpr GraphKind kind = K;			  // kind of the accepted Edges
+		static constexpr bool allWeighted = AllWeighted; // TRUE if only Weighted Edges are accepted
+	};
+
+	/// Struct that contains an estimate, in bytes, of the memory used by a Graph
+	struct MemoryUsage_struct
+	{
+		std::size_t graph = 0;			 // the Graph objects
+		std::size_t edgeSet = 0;		 // the list of the Edge Set
+		std::size_t edges = 0;			 // the Edge objects referenced by the Edge Set
+		std::size_t nodeSet = 0;		 // the list of the Node Set
+		std::size_t nodes = 0;			 // the Node objects referenced by the Node Set
+		std::size_t indexes = 0;		 // the hash indexes of the Edges and of the Nodes
+		std::size_t adjacencyMatrix = 0; // the adjacency matrix
+		std::size_t snapshots = 0;		 // the cached CSR and compressed snapshots
+		std::size_t arena = 0;			 // the capacity of the arena not used by Nodes and Edges
+		std::size_t total = 0;			 // the sum of all the above
+	};
+	typedef MemoryUsage_struct MemoryUsage;
+
 	/// Struct that contains the information about the partitioning statistics
 	
 
@@ -87,6 +159,24 @@ namespace CXXGRAPH
 	template <typename T>
 	using PartitionMap = std::map<unsigned int, PARTITIONING::Partition<T> *>;
 
+	template <typename T, typename Policy = GraphPolicy<>>
+	class Graph;
+
+	/// Graph of only Directed Weighted Edges
+	template <typename T, typename Weight = double>
+	using DirectedWeightedGraph = Graph<T, GraphPolicy<Weight, GraphKind::DIRECTED_GRAPH, true>>;
+
+	/// Graph of only Undirected Weighted Edges
+	template <typename T, typename Weight = double>
+	using UndirectedWeightedGraph = Graph<T, GraphPolicy<Weight, GraphKind::UNDIRECTED_GRAPH, true>>;
+
+	/// Dense index of a Node ( 0..V-1 ). Define CXXGRAPH_64BIT_INDEX for graphs with more than 2^32 - 1 Nodes
+#ifdef CXXGRAPH_64BIT_INDEX
+	using DenseIndex = uint64_t;
+#else
+	using DenseIndex = uint32_t;
+#endif
+
 	///////////////////////////////////////////////////////////////////////////////////	
 }
 
@@ -22,12 +22,10 @@
 
 #pragma once   // This is to make sure that this header is only included once
 
+#include "Utility/Typedef.hpp"
+
 namespace CXXGRAPH
 {
-
-	template<typename T>
-	class Graph;
-
     /*!
   	Interface to implement for a custom writer.
 	*/
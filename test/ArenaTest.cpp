@@ -0,0 +1,80 @@
+#include <memory>
+#include "gtest/gtest.h"
+#include "CXXGraph.hpp"
+
+struct ArenaCounter
+{
+    int *counter;
+    ArenaCounter(int *counter) : counter(counter) {}
+    ~ArenaCounter() { (*counter)++; }
+};
+
+TEST(ArenaTest, test_1)
+{
+    CXXGRAPH::Arena arena(64);
+    auto node = arena.create<CXXGRAPH::Node<std::string>>(1, "one");
+    ASSERT_EQ(node->getId(), 1);
+    ASSERT_EQ(node->getData(), "one");
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(node) % alignof(CXXGRAPH::Node<std::string>), 0);
+    // an allocation bigger than a block gets its own block
+    arena.allocate(1000, 8);
+    ASSERT_GE(arena.getReservedBytes(), arena.getAllocatedBytes());
+    ASSERT_GE(arena.getAllocatedBytes(), 1000 + sizeof(CXXGRAPH::Node<std::string>));
+}
+
+TEST(ArenaTest, test_2)
+{
+    int destroyed = 0;
+    {
+        CXXGRAPH::Arena arena;
+        for (int i = 0; i < 10; ++i)
+        {
+            arena.create<ArenaCounter>(&destroyed);
+        }
+        ASSERT_EQ(destroyed, 0);
+        arena.release();
+        ASSERT_EQ(destroyed, 10);
+        ASSERT_EQ(arena.getAllocatedBytes(), 0);
+        arena.create<ArenaCounter>(&destroyed);
+    }
+    ASSERT_EQ(destroyed, 11);
+}
+
+TEST(ArenaTest, test_3)
+{
+    CXXGRAPH::Node<int> node1(1, 1);
+    CXXGRAPH::Node<int> node2(2, 2);
+    CXXGRAPH::Node<int> node3(3, 3);
+    CXXGRAPH::DirectedWeightedEdge<int> edge1(1, node1, node2, 1);
+    CXXGRAPH::UndirectedWeightedEdge<int> edge2(2, node2, node3, 2);
+    std::list<const CXXGRAPH::Edge<int> *> edgeSet;
+    edgeSet.push_back(&edge1);
+    edgeSet.push_back(&edge2);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    ASSERT_EQ(graph.writeToFile(CXXGRAPH::InputOutputFormat::STANDARD_CSV, ".", "arena_graph", false, true, true), 0);
+    std::unique_ptr<CXXGRAPH::Graph<int>> readGraph(new CXXGRAPH::Graph<int>());
+    ASSERT_EQ(readGraph->readFromFile(CXXGRAPH::InputOutputFormat::STANDARD_CSV, ".", "arena_graph", false, true, true), 0);
+    // the copy shares the arena, so its Edges outlive the original Graph
+    CXXGRAPH::Graph<int> copy(*readGraph);
+    readGraph.reset();
+    ASSERT_EQ(copy.getEdgeSet().size(), 2);
+    ASSERT_EQ(copy.getNodeSet().size(), 3);
+    auto res = copy.dijkstra(node1, node3);
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.result, 3);
+}
+
+TEST(ArenaTest, test_4)
+{
+    int destroyed = 0;
+    {
+        CXXGRAPH::Arena arena;
+        auto counter = arena.adopt(std::make_unique<ArenaCounter>(&destroyed));
+        ASSERT_NE(counter, nullptr);
+        ASSERT_EQ(arena.adopt(std::unique_ptr<ArenaCounter>()), nullptr);
+        // adopted objects are not carved from the blocks
+        ASSERT_EQ(arena.getAllocatedBytes(), 0);
+        ASSERT_EQ(destroyed, 0);
+    }
+    ASSERT_EQ(destroyed, 1);
+}
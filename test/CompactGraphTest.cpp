@@ -0,0 +1,262 @@
+#include "gtest/gtest.h"
+#include "CXXGraph.hpp"
+
+TEST(CompactGraphTest, test_1)
+{
+    CXXGRAPH::Node<int> node1(1, 1);
+    CXXGRAPH::Node<int> node2(2, 2);
+    CXXGRAPH::Node<int> node3(3, 3);
+    std::pair<const CXXGRAPH::Node<int> *, const CXXGRAPH::Node<int> *> pairNode(&node1, &node2);
+    CXXGRAPH::DirectedWeightedEdge<int> edge1(1, pairNode, 1);
+    CXXGRAPH::DirectedWeightedEdge<int> edge2(2, node2, node3, 2);
+    CXXGRAPH::UndirectedWeightedEdge<int> edge3(3, node1, node3, 6);
+    std::list<const CXXGRAPH::Edge<int> *> edgeSet;
+    edgeSet.push_back(&edge1);
+    edgeSet.push_back(&edge2);
+    edgeSet.push_back(&edge3);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    auto compact = graph.freeze();
+    ASSERT_EQ(compact->getNumberOfNodes(), 3);
+    ASSERT_EQ(compact->getNumberOfLinks(), 4);
+    ASSERT_EQ(compact->getOffsets().size(), 4);
+    auto index1 = compact->getIndex(node1);
+    auto index3 = compact->getIndex(node3);
+    ASSERT_TRUE(index1.has_value());
+    ASSERT_TRUE(index3.has_value());
+    ASSERT_EQ(compact->getNode(index1.value()), &node1);
+    ASSERT_EQ(compact->getOutDegree(index1.value()), 2);
+    ASSERT_EQ(compact->getOutDegree(index3.value()), 1);
+    auto slot = compact->getOffsets()[index3.value()];
+    const auto &record = compact->getRecords()[slot];
+    ASSERT_EQ(record.from, index3.value());
+    ASSERT_EQ(record.to, index1.value());
+    ASSERT_EQ(record.weight, 6);
+    ASSERT_TRUE(record.isWeighted());
+    ASSERT_FALSE(record.isDirected());
+    ASSERT_EQ(compact->getEdges()[slot], &edge3);
+    const auto &directedRecord = compact->getRecords()[compact->getOffsets()[index1.value()]];
+    ASSERT_TRUE(directedRecord.isDirected());
+    ASSERT_EQ(directedRecord.weight, 1);
+}
+
+TEST(CompactGraphTest, test_2)
+{
+    CXXGRAPH::Node<int> node1(1, 1);
+    CXXGRAPH::Node<int> node2(2, 2);
+    CXXGRAPH::Node<int> node3(3, 3);
+    CXXGRAPH::DirectedEdge<int> edge1(1, node1, node2);
+    CXXGRAPH::DirectedEdge<int> edge2(2, node2, node3);
+    std::list<const CXXGRAPH::Edge<int> *> edgeSet;
+    edgeSet.push_back(&edge1);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    auto compact = graph.freeze();
+    // the snapshot is cached until the graph is modified
+    ASSERT_EQ(compact, graph.freeze());
+    graph.addEdge(&edge2);
+    auto compact2 = graph.freeze();
+    ASSERT_NE(compact, compact2);
+    ASSERT_EQ(compact->getNumberOfNodes(), 2);
+    ASSERT_EQ(compact2->getNumberOfNodes(), 3);
+    ASSERT_FALSE(compact->getIndex(node3).has_value());
+    ASSERT_TRUE(compact2->getIndex(node3).has_value());
+}
+
+TEST(CompactGraphTest, test_3)
+{
+    CXXGRAPH::Node<int> node1(1, 1);
+    CXXGRAPH::Node<int> node2(2, 2);
+    std::pair<const CXXGRAPH::Node<int> *, const CXXGRAPH::Node<int> *> pairNode(&node1, &node2);
+    CXXGRAPH::Edge<int> edge(1, pairNode);
+    std::list<const CXXGRAPH::Edge<int> *> edgeSet;
+    edgeSet.push_back(&edge);
+    CXXGRAPH::Graph_TS<int> graph(edgeSet);
+    auto compact = graph.freeze();
+    // a simple Edge has no direction so it does not generate links
+    ASSERT_EQ(compact->getNumberOfNodes(), 2);
+    ASSERT_EQ(compact->getNumberOfLinks(), 0);
+}
+
+TEST(CompactGraphTest, test_4)
+{
+    CXXGRAPH::Node<int> node1(1, 1);
+    CXXGRAPH::Node<int> node2(2, 2);
+    CXXGRAPH::Node<int> node1bis(1, 5);
+    CXXGRAPH::NodeIndex<int> nodeIndex;
+    ASSERT_EQ(nodeIndex.insert(&node2), 0);
+    ASSERT_EQ(nodeIndex.insert(&node1), 1);
+    // a Node with an already indexed id keeps its index
+    ASSERT_EQ(nodeIndex.insert(&node2), 0);
+    ASSERT_EQ(nodeIndex.size(), 2);
+    ASSERT_EQ(nodeIndex.getNode(1), &node1);
+    ASSERT_EQ(nodeIndex.getIndex(node1).value(), 1);
+    ASSERT_EQ(nodeIndex.getIndex(2ul).value(), 0);
+    // same id but different data is not the same Node
+    ASSERT_FALSE(nodeIndex.getIndex(node1bis).has_value());
+    ASSERT_FALSE(nodeIndex.getIndex(3ul).has_value());
+}
+
+TEST(CompactGraphTest, test_5)
+{
+    // nodes are inserted so that the first gap of some lists is negative and some gaps need two bytes
+    std::vector<CXXGRAPH::Node<int> *> nodes;
+    for (int i = 0; i < 300; ++i)
+    {
+        nodes.push_back(new CXXGRAPH::Node<int>(i, i));
+    }
+    std::vector<CXXGRAPH::Edge<int> *> edges;
+    unsigned long edgeId = 0;
+    for (int i = 0; i < 300; ++i)
+    {
+        edges.push_back(new CXXGRAPH::DirectedWeightedEdge<int>(edgeId++, *nodes[i], *nodes[(i * 7 + 3) % 300], i % 5 + 1));
+        edges.push_back(new CXXGRAPH::UndirectedWeightedEdge<int>(edgeId++, *nodes[i], *nodes[299 - i], 2));
+    }
+    CXXGRAPH::Graph<int> graph;
+    graph.addEdges(edges.begin(), edges.end());
+    auto compact = graph.freeze();
+    auto compressed = graph.freezeCompressed();
+    ASSERT_EQ(compressed->getNumberOfNodes(), compact->getNumberOfNodes());
+    ASSERT_EQ(compressed->getNumberOfLinks(), compact->getNumberOfLinks());
+    // the small integer weights are varints next to the gaps, the flags are packed in the gaps
+    ASSERT_LT(compressed->getEncodedSize(), 3 * compressed->getNumberOfLinks());
+    ASSERT_LT(compressed->memoryUsage(), compact->memoryUsage());
+    for (CXXGRAPH::DenseIndex node = 0; node < compact->getNumberOfNodes(); ++node)
+    {
+        // the compressed links are the CSR links sorted by destination
+        std::vector<std::pair<CXXGRAPH::DenseIndex, double>> expected;
+        compact->forEachLink(node, [&](const CXXGRAPH::EdgeRecord &record)
+                             { expected.emplace_back(record.to, record.weight); });
+        std::stable_sort(expected.begin(), expected.end(), [](const auto &a, const auto &b)
+                         { return a.first < b.first; });
+        std::vector<std::pair<CXXGRAPH::DenseIndex, double>> decoded;
+        compressed->forEachLink(node, [&](const CXXGRAPH::EdgeRecord &record)
+                                {
+                                    ASSERT_EQ(record.from, node);
+                                    ASSERT_TRUE(record.isWeighted());
+                                    decoded.emplace_back(record.to, record.weight); });
+        ASSERT_EQ(decoded, expected);
+    }
+    auto bfs = graph.breadth_first_search(*nodes[0]);
+    auto dfs = graph.depth_first_search(*nodes[0]);
+    auto dijkstra = graph.dijkstra(*nodes[0], bfs.back());
+    ASSERT_TRUE(dijkstra.success);
+    graph.setCompressedAdjacency(true);
+    ASSERT_TRUE(graph.isCompressedAdjacency());
+    ASSERT_EQ(graph.breadth_first_search(*nodes[0]).size(), bfs.size());
+    ASSERT_EQ(graph.depth_first_search(*nodes[0]).size(), dfs.size());
+    auto compressedDijkstra = graph.dijkstra(*nodes[0], bfs.back());
+    ASSERT_TRUE(compressedDijkstra.success);
+    ASSERT_EQ(compressedDijkstra.result, dijkstra.result);
+    for (auto edge : edges)
+    {
+        delete edge;
+    }
+    for (auto node : nodes)
+    {
+        delete node;
+    }
+}
+
+TEST(CompactGraphTest, test_6)
+{
+    CXXGRAPH::Node<int> node1(1, 1);
+    CXXGRAPH::Node<int> node2(2, 2);
+    CXXGRAPH::Node<int> node3(3, 3);
+    CXXGRAPH::DirectedWeightedEdge<int> edge1(1, node1, node2, 3);
+    CXXGRAPH::DirectedEdge<int> edge2(2, node2, node3);
+    CXXGRAPH::DirectedWeightedEdge<int> edge3(3, node3, node1, 4.5);
+    std::list<const CXXGRAPH::Edge<int> *> edgeSet = {&edge1, &edge2, &edge3};
+    CXXGRAPH::Graph_TS<int> graph(edgeSet);
+    auto columns = graph.getEdgeColumns();
+    ASSERT_EQ(columns->size(), 3);
+    ASSERT_EQ(columns->getIds(), std::vector<unsigned long>({1, 2, 3}));
+    ASSERT_EQ(columns->getNodeIndex().getNode(columns->getSources()[2]), &node3);
+    ASSERT_EQ(columns->getNodeIndex().getNode(columns->getTargets()[2]), &node1);
+    ASSERT_EQ(columns->getWeighted(), std::vector<std::uint8_t>({1, 0, 1}));
+    ASSERT_TRUE(columns->isAllDirected());
+    ASSERT_EQ(columns->getTotalWeight(), 7.5);
+    ASSERT_EQ(columns->getMaxWeight(), 4.5);
+    // the cycle checks scan the directed column without taking the lock again
+    ASSERT_TRUE(graph.isDirectedGraph());
+    ASSERT_TRUE(graph.isCyclicDirectedGraphDFS());
+    ASSERT_TRUE(graph.isCyclicDirectedGraphBFS());
+    CXXGRAPH::UndirectedEdge<int> edge4(4, node1, node3);
+    graph.addEdge(&edge4);
+    ASSERT_NE(columns, graph.getEdgeColumns());
+    ASSERT_FALSE(graph.isDirectedGraph());
+}
+
+TEST(CompactGraphTest, test_7)
+{
+    CXXGRAPH::Node<int> node1(1, 1);
+    CXXGRAPH::Node<int> node2(2, 2);
+    CXXGRAPH::Node<int> node3(3, 3);
+    CXXGRAPH::Node<int> node4(4, 4);
+    CXXGRAPH::DirectedWeightedEdge<int> edge1(1, node1, node3, 1);
+    CXXGRAPH::DirectedWeightedEdge<int> edge2(2, node2, node3, 2);
+    CXXGRAPH::UndirectedWeightedEdge<int> edge3(3, node3, node4, 3);
+    std::list<const CXXGRAPH::Edge<int> *> edgeSet;
+    edgeSet.push_back(&edge1);
+    edgeSet.push_back(&edge2);
+    edgeSet.push_back(&edge3);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    auto compact = graph.freeze();
+    auto index3 = compact->getIndex(node3).value();
+    ASSERT_EQ(compact->getInDegree(index3), 3);
+    ASSERT_EQ(compact->getInDegree(compact->getIndex(node1).value()), 0);
+    ASSERT_EQ(compact->getReverseOffsets().size(), 5);
+    ASSERT_EQ(compact->getReverseLinks().size(), compact->getNumberOfLinks());
+    std::vector<double> weights;
+    compact->forEachInLink(index3, [&weights, index3](std::size_t, const auto &record)
+                           {
+                               ASSERT_EQ(record.to, index3);
+                               weights.push_back(record.weight); });
+    ASSERT_EQ(weights, std::vector<double>({1, 2, 3}));
+
+    auto predecessors = graph.getPredecessors(node3);
+    ASSERT_EQ(predecessors, std::vector<const CXXGRAPH::Node<int> *>({&node1, &node2, &node4}));
+    ASSERT_EQ(graph.getInDegree(node4), 1);
+    ASSERT_EQ(graph.getInDegree(node2), 0);
+
+    // the removed Edges are hidden also from the reverse index
+    graph.setTombstoneRemoval(true);
+    graph.setCompactionThreshold(0.9);
+    graph.removeEdge(2);
+    ASSERT_EQ(graph.getNumberOfTombstones(), 1);
+    ASSERT_EQ(graph.getInDegree(node3), 2);
+    ASSERT_EQ(graph.getPredecessors(node3), std::vector<const CXXGRAPH::Node<int> *>({&node1, &node4}));
+    ASSERT_EQ(graph.getInDegree(node2), 0);
+
+    CXXGRAPH::Graph_TS<int> graph_ts(edgeSet);
+    ASSERT_EQ(graph_ts.getInDegree(node3), 3);
+    ASSERT_EQ(graph_ts.getPredecessors(node1).size(), 0);
+}
+
+TEST(CompactGraphTest, test_8)
+{
+    // weights that are not integers and links without weight decode as in the CSR snapshot
+    CXXGRAPH::Node<int> node1(1, 1);
+    CXXGRAPH::Node<int> node2(2, 2);
+    CXXGRAPH::Node<int> node3(3, 3);
+    CXXGRAPH::DirectedWeightedEdge<int> edge1(1, node1, node2, 3);
+    CXXGRAPH::DirectedEdge<int> edge2(2, node2, node3);
+    CXXGRAPH::UndirectedWeightedEdge<int> edge3(3, node3, node1, 4.5);
+    CXXGRAPH::DirectedWeightedEdge<int> edge4(4, node1, node3, -2);
+    std::list<const CXXGRAPH::Edge<int> *> edgeSet = {&edge1, &edge2, &edge3, &edge4};
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    auto compact = graph.freeze();
+    auto compressed = graph.freezeCompressed();
+    ASSERT_EQ(compressed->getNumberOfLinks(), 5);
+    for (CXXGRAPH::DenseIndex node = 0; node < compact->getNumberOfNodes(); ++node)
+    {
+        std::vector<std::tuple<CXXGRAPH::DenseIndex, double, std::uint8_t>> expected;
+        compact->forEachLink(node, [&](const CXXGRAPH::EdgeRecord &record)
+                             { expected.emplace_back(record.to, record.weight, record.flags); });
+        std::stable_sort(expected.begin(), expected.end(), [](const auto &a, const auto &b)
+                         { return std::get<0>(a) < std::get<0>(b); });
+        std::vector<std::tuple<CXXGRAPH::DenseIndex, double, std::uint8_t>> decoded;
+        compressed->forEachLink(node, [&](const CXXGRAPH::EdgeRecord &record)
+                                { decoded.emplace_back(record.to, record.weight, record.flags); });
+        ASSERT_EQ(decoded, expected);
+        ASSERT_EQ(compressed->getOutDegree(node), expected.size());
+    }
+}
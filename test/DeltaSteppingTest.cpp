@@ -0,0 +1,157 @@
+#include <algorithm>
+#include <random>
+#include "gtest/gtest.h"
+#include "CXXGraph.hpp"
+
+// the distance of a Node in the result, the distances are in the same order of the Node ids
+template <typename Result>
+static auto distanceOf(const Result &res, unsigned long nodeId)
+{
+    auto position = std::find(res.nodeIds.begin(), res.nodeIds.end(), nodeId) - res.nodeIds.begin();
+    return res.distances.at(position);
+}
+
+TEST(DeltaSteppingTest, test_1)
+{
+    CXXGRAPH::Node<int> node1(1, 1);
+    CXXGRAPH::Node<int> node2(2, 2);
+    CXXGRAPH::Node<int> node3(3, 3);
+    CXXGRAPH::Node<int> node4(4, 4);
+    std::pair<const CXXGRAPH::Node<int> *, const CXXGRAPH::Node<int> *> pairNode(&node1, &node2);
+    CXXGRAPH::DirectedWeightedEdge<int> edge1(1, pairNode, 1);
+    CXXGRAPH::DirectedWeightedEdge<int> edge2(2, node2, node3, 1);
+    CXXGRAPH::UndirectedWeightedEdge<int> edge3(3, node1, node3, 6);
+    CXXGRAPH::DirectedWeightedEdge<int> edge4(4, node4, node1, 2);
+    std::list<const CXXGRAPH::Edge<int> *> edgeSet;
+    edgeSet.push_back(&edge1);
+    edgeSet.push_back(&edge2);
+    edgeSet.push_back(&edge3);
+    edgeSet.push_back(&edge4);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    for (double delta : {0.5, 1.0, 3.0, 100.0})
+    {
+        auto res = graph.deltaStepping(node1, delta, 2);
+        ASSERT_TRUE(res.success);
+        ASSERT_EQ(res.errorMessage, "");
+        ASSERT_EQ(distanceOf(res, 1), 0);
+        ASSERT_EQ(distanceOf(res, 2), 1);
+        ASSERT_EQ(distanceOf(res, 3), 2);
+        ASSERT_EQ(distanceOf(res, 4), CXXGRAPH::INF_DOUBLE);
+    }
+}
+
+TEST(DeltaSteppingTest, test_2)
+{
+    CXXGRAPH::Node<int> node1(1, 1);
+    CXXGRAPH::Node<int> node2(2, 2);
+    CXXGRAPH::Node<int> node3(3, 3);
+    CXXGRAPH::DirectedEdge<int> edge1(1, node1, node2);
+    CXXGRAPH::UndirectedWeightedEdge<int> edge2(2, node1, node3, 6);
+    std::list<const CXXGRAPH::Edge<int> *> edgeSet;
+    edgeSet.push_back(&edge1);
+    edgeSet.push_back(&edge2);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    auto res = graph.deltaStepping(node1, 1, 2);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_NO_WEIGHTED_EDGE);
+    ASSERT_TRUE(res.nodeIds.empty());
+
+    CXXGRAPH::Node<int> node4(4, 4);
+    res = graph.deltaStepping(node4, 1);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_SOURCE_NODE_NOT_IN_GRAPH);
+    ASSERT_TRUE(res.nodeIds.empty());
+
+    res = graph.deltaStepping(node3, 0);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_DELTA_NOT_POSITIVE);
+    ASSERT_TRUE(res.nodeIds.empty());
+}
+
+TEST(DeltaSteppingTest, test_3)
+{
+    // same distances of dijkstra on a random graph, for any delta and number of threads
+    std::mt19937 generator(11);
+    std::uniform_int_distribution<unsigned long> nodeDistribution(0, 499);
+    std::uniform_real_distribution<double> weightDistribution(0, 10);
+    std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+    for (int i = 0; i < 500; ++i)
+    {
+        nodes.push_back(std::make_unique<CXXGRAPH::Node<int>>(i, i));
+    }
+    std::vector<std::unique_ptr<CXXGRAPH::DirectedWeightedEdge<int>>> edges;
+    CXXGRAPH::Graph_TS<int> graph;
+    for (unsigned long i = 0; i < 3000; ++i)
+    {
+        edges.push_back(std::make_unique<CXXGRAPH::DirectedWeightedEdge<int>>(i, *nodes[nodeDistribution(generator)], *nodes[nodeDistribution(generator)], weightDistribution(generator)));
+        graph.addEdge(edges.back().get());
+    }
+    graph.setTombstoneRemoval(true);
+    graph.freeze();
+    graph.removeEdge(10);
+    auto expected = graph.dijkstraAll(*nodes[0]);
+    ASSERT_TRUE(expected.success);
+    for (double delta : {0.1, 2.0, 5.0, 50.0})
+    {
+        for (unsigned int threads : {1u, 4u})
+        {
+            auto res = graph.deltaStepping(*nodes[0], delta, threads);
+            ASSERT_TRUE(res.success);
+            ASSERT_EQ(res.nodeIds.size(), expected.nodeIds.size());
+            for (std::size_t i = 0; i < expected.nodeIds.size(); ++i)
+            {
+                ASSERT_DOUBLE_EQ(distanceOf(res, expected.nodeIds[i]), expected.distances[i]);
+            }
+        }
+    }
+}
+
+TEST(DeltaSteppingTest, test_4)
+{
+    // the weights can be many orders of magnitude larger than delta
+    CXXGRAPH::Node<int> node1(1, 1);
+    CXXGRAPH::Node<int> node2(2, 2);
+    CXXGRAPH::Node<int> node3(3, 3);
+    CXXGRAPH::DirectedWeightedEdge<int> edge1(1, node1, node2, 1e9);
+    CXXGRAPH::DirectedWeightedEdge<int> edge2(2, node2, node3, 1e12);
+    CXXGRAPH::DirectedWeightedEdge<int> edge3(3, node1, node3, 2e12);
+    std::list<const CXXGRAPH::Edge<int> *> edgeSet;
+    edgeSet.push_back(&edge1);
+    edgeSet.push_back(&edge2);
+    edgeSet.push_back(&edge3);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    for (double delta : {1.0, 0.5})
+    {
+        auto res = graph.deltaStepping(node1, delta, 2);
+        ASSERT_TRUE(res.success);
+        ASSERT_EQ(distanceOf(res, 2), 1e9);
+        ASSERT_EQ(distanceOf(res, 3), 1e12 + 1e9);
+    }
+}
+
+TEST(DeltaSteppingTest, test_5)
+{
+    // a negative weight, or a weight that is not a number, is rejected before the search starts
+    CXXGRAPH::Node<int> node1(1, 1);
+    CXXGRAPH::Node<int> node2(2, 2);
+    CXXGRAPH::Node<int> node3(3, 3);
+    CXXGRAPH::DirectedWeightedEdge<int> edge1(1, node1, node2, 1);
+    CXXGRAPH::DirectedWeightedEdge<int> edge2(2, node2, node3, -1);
+    std::list<const CXXGRAPH::Edge<int> *> edgeSet;
+    edgeSet.push_back(&edge1);
+    edgeSet.push_back(&edge2);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    auto res = graph.deltaStepping(node1, 1, 2);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_WEIGHT_OUT_OF_RANGE);
+    ASSERT_TRUE(res.nodeIds.empty());
+
+    CXXGRAPH::DirectedWeightedEdge<int> edge3(3, node2, node3, std::nan(""));
+    edgeSet.pop_back();
+    edgeSet.push_back(&edge3);
+    CXXGRAPH::Graph<int> nanGraph(edgeSet);
+    res = nanGraph.deltaStepping(node1, 1, 2);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_WEIGHT_OUT_OF_RANGE);
+    ASSERT_TRUE(res.nodeIds.empty());
+}
@@ -1,6 +1,16 @@
+#include <algorithm>
+#include <random>
 #include "gtest/gtest.h"
 #include "CXXGraph.hpp"
 
+// the distance of a Node in the result, the distances are in the same order of the Node ids
+template <typename Result>
+static auto distanceOf(const Result &res, unsigned long nodeId)
+{
+    auto position = std::find(res.nodeIds.begin(), res.nodeIds.end(), nodeId) - res.nodeIds.begin();
+    return res.distances.at(position);
+}
+
 TEST(DialTest, test_1)
 {
     CXXGRAPH::Node<int> node1(1, 1);
@@ -18,9 +28,9 @@ TEST(DialTest, test_1)
     auto res = graph.dial(node1, 6);
     ASSERT_TRUE(res.success);
     ASSERT_EQ(res.errorMessage, "");
-    ASSERT_EQ(res.minDistanceMap.at(1), 0);
-    ASSERT_EQ(res.minDistanceMap.at(2), 1);
-    ASSERT_EQ(res.minDistanceMap.at(3), 2);
+    ASSERT_EQ(distanceOf(res, 1), 0);
+    ASSERT_EQ(distanceOf(res, 2), 1);
+    ASSERT_EQ(distanceOf(res, 3), 2);
 }
 
 TEST(DialTest, test_2)
@@ -41,9 +51,9 @@ TEST(DialTest, test_2)
     ;
     ASSERT_TRUE(res.success);
     ASSERT_EQ(res.errorMessage, "");
-    ASSERT_EQ(res.minDistanceMap.at(1), 0);
-    ASSERT_EQ(res.minDistanceMap.at(2), 5);
-    ASSERT_EQ(res.minDistanceMap.at(3), 6);
+    ASSERT_EQ(distanceOf(res, 1), 0);
+    ASSERT_EQ(distanceOf(res, 2), 5);
+    ASSERT_EQ(distanceOf(res, 3), 6);
 }
 
 TEST(DialTest, test_3)
@@ -63,7 +73,7 @@ TEST(DialTest, test_3)
     auto res = graph.dial(node1, 6);
     ASSERT_FALSE(res.success);
     ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_NO_WEIGHTED_EDGE);
-    ASSERT_TRUE(res.minDistanceMap.empty());
+    ASSERT_TRUE(res.nodeIds.empty());
 }
 
 TEST(DialTest, test_4)
@@ -80,9 +90,9 @@ TEST(DialTest, test_4)
     auto res = graph.dial(node1, 6);
     ASSERT_TRUE(res.success);
     ASSERT_EQ(res.errorMessage, "");
-    ASSERT_EQ(res.minDistanceMap.at(1), 0);
-    ASSERT_EQ(res.minDistanceMap.at(2), std::numeric_limits<long>::max());
-    ASSERT_EQ(res.minDistanceMap.at(3), 6);
+    ASSERT_EQ(distanceOf(res, 1), 0);
+    ASSERT_EQ(distanceOf(res, 2), std::numeric_limits<long>::max());
+    ASSERT_EQ(distanceOf(res, 3), 6);
 }
 
 TEST(DialTest, test_5)
@@ -100,5 +110,74 @@ TEST(DialTest, test_5)
     auto res = graph.dial(node4, 6);
     ASSERT_FALSE(res.success);
     ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_SOURCE_NODE_NOT_IN_GRAPH);
-    ASSERT_TRUE(res.minDistanceMap.empty());
-}
\ No newline at end of file
+    ASSERT_TRUE(res.nodeIds.empty());
+}
+TEST(DialTest, test_6)
+{
+    CXXGRAPH::Node<int> node1(1, 1);
+    CXXGRAPH::Node<int> node2(2, 2);
+    CXXGRAPH::DirectedWeightedEdge<int> edge1(1, node1, node2, 7);
+    std::list<const CXXGRAPH::Edge<int> *> edgeSet;
+    edgeSet.push_back(&edge1);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    auto res = graph.dial(node1, 6);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_WEIGHT_OUT_OF_RANGE);
+    ASSERT_TRUE(res.nodeIds.empty());
+    res = graph.dial(node1, -1);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_WEIGHT_OUT_OF_RANGE);
+    res = graph.dial(node1, 7);
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(distanceOf(res, 2), 7);
+
+    // a weight that is not an integer, or not a number, has no bucket
+    CXXGRAPH::DirectedWeightedEdge<int> fractional(2, node1, node2, 2.7);
+    CXXGRAPH::DirectedWeightedEdge<int> nan(3, node1, node2, std::numeric_limits<double>::quiet_NaN());
+    CXXGRAPH::Graph<int> other;
+    other.addEdge(&fractional);
+    res = other.dial(node1, 7);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_WEIGHT_OUT_OF_RANGE);
+    other.removeEdge(2);
+    other.addEdge(&nan);
+    res = other.dial(node1, 7);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_WEIGHT_OUT_OF_RANGE);
+}
+
+TEST(DialTest, test_7)
+{
+    // same distances of dijkstra on a random graph, too large for the buckets on the stack
+    std::mt19937 generator(5);
+    std::uniform_int_distribution<unsigned long> nodeDistribution(0, 49999);
+    std::uniform_int_distribution<int> weightDistribution(0, 100);
+    std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+    for (int i = 0; i < 50000; ++i)
+    {
+        nodes.push_back(std::make_unique<CXXGRAPH::Node<int>>(i, i));
+    }
+    std::vector<std::unique_ptr<CXXGRAPH::DirectedWeightedEdge<int>>> edges;
+    CXXGRAPH::Graph<int> graph;
+    for (unsigned long i = 0; i < 200000; ++i)
+    {
+        edges.push_back(std::make_unique<CXXGRAPH::DirectedWeightedEdge<int>>(i, *nodes[nodeDistribution(generator)], *nodes[nodeDistribution(generator)], weightDistribution(generator)));
+        graph.addEdge(edges.back().get());
+    }
+    auto expected = graph.dijkstraAll(*nodes[0]);
+    ASSERT_TRUE(expected.success);
+    auto res = graph.dial(*nodes[0], 100);
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.nodeIds, expected.nodeIds);
+    for (std::size_t i = 0; i < res.distances.size(); ++i)
+    {
+        if (expected.distances[i] == CXXGRAPH::INF_DOUBLE)
+        {
+            ASSERT_EQ(res.distances[i], std::numeric_limits<long>::max());
+        }
+        else
+        {
+            ASSERT_EQ(res.distances[i], expected.distances[i]);
+        }
+    }
+}
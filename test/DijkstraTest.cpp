@@ -1,3 +1,4 @@
+#include <random>
 #include "gtest/gtest.h"
 #include "CXXGraph.hpp"
 
@@ -112,4 +113,450 @@ TEST(DijkstraTest, test_6)
     ASSERT_FALSE(res.success);
     ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_TARGET_NODE_NOT_IN_GRAPH);
     ASSERT_EQ(res.result, CXXGRAPH::INF_DOUBLE);
-}
\ No newline at end of file
+}
+TEST(DijkstraTest, test_7)
+{
+    CXXGRAPH::Node<int> node1(1, 1);
+    CXXGRAPH::Node<int> node2(2, 2);
+    CXXGRAPH::Node<int> node3(3, 3);
+    CXXGRAPH::Node<int> node4(4, 4);
+    CXXGRAPH::DirectedWeightedEdge<int> edge1(1, node1, node2, 1);
+    CXXGRAPH::DirectedWeightedEdge<int> edge2(2, node2, node3, 1);
+    CXXGRAPH::UndirectedWeightedEdge<int> edge3(3, node1, node3, 6);
+    CXXGRAPH::DirectedWeightedEdge<int> edge4(4, node3, node4, 2);
+    std::list<const CXXGRAPH::Edge<int> *> edgeSet;
+    edgeSet.push_back(&edge1);
+    edgeSet.push_back(&edge2);
+    edgeSet.push_back(&edge3);
+    edgeSet.push_back(&edge4);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    CXXGRAPH::DijkstraResult res = graph.dijkstra(node1, node4);
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.result, 4);
+    ASSERT_EQ(res.path, std::vector<unsigned long>({1, 2, 3, 4}));
+    res = graph.dijkstra(node3, node2);
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.result, 7);
+    ASSERT_EQ(res.path, std::vector<unsigned long>({3, 1, 2}));
+    res = graph.dijkstra(node2, node2);
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.result, 0);
+    ASSERT_EQ(res.path, std::vector<unsigned long>({2}));
+    res = graph.dijkstra(node4, node1);
+    ASSERT_FALSE(res.success);
+    ASSERT_TRUE(res.path.empty());
+}
+
+TEST(DijkstraTest, test_8)
+{
+    CXXGRAPH::Node<int> node1(1, 1);
+    CXXGRAPH::Node<int> node2(2, 2);
+    CXXGRAPH::Node<int> node3(3, 3);
+    CXXGRAPH::Node<int> node4(4, 4);
+    CXXGRAPH::DirectedWeightedEdge<int> edge1(1, node1, node2, 1);
+    CXXGRAPH::DirectedWeightedEdge<int> edge2(2, node2, node3, 1);
+    CXXGRAPH::UndirectedWeightedEdge<int> edge3(3, node1, node3, 6);
+    CXXGRAPH::DirectedWeightedEdge<int> edge4(4, node4, node3, 2);
+    std::list<const CXXGRAPH::Edge<int> *> edgeSet;
+    edgeSet.push_back(&edge1);
+    edgeSet.push_back(&edge2);
+    edgeSet.push_back(&edge3);
+    edgeSet.push_back(&edge4);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    CXXGRAPH::DijkstraAllResult res = graph.dijkstraAll(node1);
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.nodeIds.size(), 4);
+    ASSERT_EQ(res.distances.size(), 4);
+    for (std::size_t i = 0; i < res.nodeIds.size(); ++i)
+    {
+        switch (res.nodeIds[i])
+        {
+        case 1:
+            ASSERT_EQ(res.distances[i], 0);
+            ASSERT_EQ(res.predecessors[i], i);
+            break;
+        case 3:
+            ASSERT_EQ(res.distances[i], 2);
+            ASSERT_EQ(res.nodeIds[res.predecessors[i]], 2);
+            break;
+        case 4:
+            ASSERT_EQ(res.distances[i], CXXGRAPH::INF_DOUBLE);
+            ASSERT_EQ(res.predecessors[i], i);
+            break;
+        }
+    }
+    CXXGRAPH::Node<int> node5(5, 5);
+    ASSERT_EQ(graph.dijkstraAll(node5).errorMessage, CXXGRAPH::ERR_SOURCE_NODE_NOT_IN_GRAPH);
+    CXXGRAPH::DirectedEdge<int> edge5(5, node1, node4);
+    graph.addEdge(&edge5);
+    res = graph.dijkstraAll(node1);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_NO_WEIGHTED_EDGE);
+}
+
+TEST(DijkstraTest, test_9)
+{
+    // compare with Bellman-Ford on a random graph
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<unsigned long> nodeDistribution(0, 199);
+    std::uniform_int_distribution<int> weightDistribution(1, 20);
+    std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+    for (int i = 0; i < 200; ++i)
+    {
+        nodes.push_back(std::make_unique<CXXGRAPH::Node<int>>(i, i));
+    }
+    std::vector<std::unique_ptr<CXXGRAPH::DirectedWeightedEdge<int>>> edges;
+    CXXGRAPH::Graph<int> graph;
+    for (unsigned long i = 0; i < 1500; ++i)
+    {
+        edges.push_back(std::make_unique<CXXGRAPH::DirectedWeightedEdge<int>>(i, *nodes[nodeDistribution(generator)], *nodes[nodeDistribution(generator)], weightDistribution(generator)));
+        graph.addEdge(edges.back().get());
+    }
+    std::vector<double> expected(200, CXXGRAPH::INF_DOUBLE);
+    expected[0] = 0;
+    for (int round = 0; round < 200; ++round)
+    {
+        for (const auto &edge : edges)
+        {
+            auto from = edge->getNodePair().first->getId();
+            auto to = edge->getNodePair().second->getId();
+            if (expected[from] != CXXGRAPH::INF_DOUBLE && expected[from] + edge->getWeight() < expected[to])
+            {
+                expected[to] = expected[from] + edge->getWeight();
+            }
+        }
+    }
+    auto all = graph.dijkstraAll(*nodes[0]);
+    ASSERT_TRUE(all.success);
+    for (std::size_t i = 0; i < all.nodeIds.size(); ++i)
+    {
+        ASSERT_EQ(all.distances[i], expected[all.nodeIds[i]]);
+    }
+    for (unsigned long target = 1; target < 200; target += 7)
+    {
+        auto res = graph.dijkstra(*nodes[0], *nodes[target]);
+        if (expected[target] == CXXGRAPH::INF_DOUBLE)
+        {
+            ASSERT_FALSE(res.success);
+            continue;
+        }
+        ASSERT_TRUE(res.success);
+        ASSERT_EQ(res.result, expected[target]);
+        // the path is made of existing links and its length is the distance
+        double length = 0;
+        for (std::size_t i = 0; i + 1 < res.path.size(); ++i)
+        {
+            double best = CXXGRAPH::INF_DOUBLE;
+            for (auto edge : graph.getEdgesBetween(*nodes[res.path[i]], *nodes[res.path[i + 1]]))
+            {
+                best = std::min(best, dynamic_cast<const CXXGRAPH::Weighted *>(edge)->getWeight());
+            }
+            ASSERT_NE(best, CXXGRAPH::INF_DOUBLE);
+            length += best;
+        }
+        ASSERT_EQ(length, res.result);
+    }
+}
+
+TEST(DijkstraTest, test_10)
+{
+    std::mt19937 generator(11);
+    std::uniform_int_distribution<unsigned long> nodeDistribution(0, 299);
+    std::uniform_int_distribution<int> weightDistribution(1, 50);
+    std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+    for (int i = 0; i < 300; ++i)
+    {
+        nodes.push_back(std::make_unique<CXXGRAPH::Node<int>>(i, i));
+    }
+    std::vector<std::unique_ptr<CXXGRAPH::UndirectedWeightedEdge<int>>> edges;
+    CXXGRAPH::Graph<int> graph;
+    for (unsigned long i = 0; i < 900; ++i)
+    {
+        edges.push_back(std::make_unique<CXXGRAPH::UndirectedWeightedEdge<int>>(i, *nodes[nodeDistribution(generator)], *nodes[nodeDistribution(generator)], weightDistribution(generator)));
+        graph.addEdge(edges.back().get());
+    }
+    std::vector<const CXXGRAPH::Node<int> *> sources;
+    std::vector<const CXXGRAPH::Node<int> *> targets;
+    for (int i = 0; i < 40; ++i)
+    {
+        auto source = graph.getNode(nodeDistribution(generator));
+        if (source.has_value())
+        {
+            sources.push_back(source.value());
+        }
+        auto target = graph.getNode(nodeDistribution(generator));
+        if (target.has_value())
+        {
+            targets.push_back(target.value());
+        }
+    }
+    // the same target twice gets the same column
+    targets.push_back(targets.front());
+    for (unsigned int threads : {1u, 4u})
+    {
+        auto batch = graph.dijkstraBatch(sources, targets, threads);
+        ASSERT_TRUE(batch.success);
+        ASSERT_EQ(batch.numberOfTargets, targets.size());
+        ASSERT_EQ(batch.distances.size(), sources.size() * targets.size());
+        for (std::size_t i = 0; i < sources.size(); ++i)
+        {
+            for (std::size_t j = 0; j < targets.size(); ++j)
+            {
+                auto single = graph.dijkstra(*sources[i], *targets[j]);
+                ASSERT_EQ(batch.distances[i * targets.size() + j], single.success ? single.result : CXXGRAPH::INF_DOUBLE);
+            }
+        }
+    }
+    CXXGRAPH::Node<int> outside(1000, 1000);
+    ASSERT_EQ(graph.dijkstraBatch({&outside}, targets).errorMessage, CXXGRAPH::ERR_SOURCE_NODE_NOT_IN_GRAPH);
+    ASSERT_EQ(graph.dijkstraBatch(sources, {&outside}).errorMessage, CXXGRAPH::ERR_TARGET_NODE_NOT_IN_GRAPH);
+    ASSERT_TRUE(graph.dijkstraBatch({}, targets).success);
+    CXXGRAPH::DirectedEdge<int> unweighted(1000, *sources.front(), outside);
+    graph.addEdge(&unweighted);
+    ASSERT_EQ(graph.dijkstraBatch(sources, targets, 4).errorMessage, CXXGRAPH::ERR_NO_WEIGHTED_EDGE);
+}
+
+TEST(DijkstraTest, test_11)
+{
+    // bidirectional dijkstra finds the distances of dijkstra on random directed and undirected graphs
+    std::mt19937 generator(7);
+    std::uniform_int_distribution<unsigned long> nodeDistribution(0, 299);
+    std::uniform_int_distribution<int> weightDistribution(0, 20);
+    std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+    for (int i = 0; i < 300; ++i)
+    {
+        nodes.push_back(std::make_unique<CXXGRAPH::Node<int>>(i, i));
+    }
+    std::vector<std::unique_ptr<CXXGRAPH::Edge<int>>> edges;
+    CXXGRAPH::Graph<int> directed;
+    CXXGRAPH::Graph<int> undirected;
+    for (unsigned long i = 0; i < 900; ++i)
+    {
+        auto &from = *nodes[nodeDistribution(generator)];
+        auto &to = *nodes[nodeDistribution(generator)];
+        auto weight = weightDistribution(generator);
+        edges.push_back(std::make_unique<CXXGRAPH::DirectedWeightedEdge<int>>(i, from, to, weight));
+        directed.addEdge(edges.back().get());
+        edges.push_back(std::make_unique<CXXGRAPH::UndirectedWeightedEdge<int>>(i, from, to, weight));
+        undirected.addEdge(edges.back().get());
+    }
+    // a removed Edge must not be followed by the backward search
+    directed.setTombstoneRemoval(true);
+    directed.freeze();
+    directed.removeEdge(5);
+    for (const auto *graph : {&directed, &undirected})
+    {
+        for (unsigned long i = 0; i < 300; i += 3)
+        {
+            auto &source = *nodes[i];
+            auto &target = *nodes[(i * 17 + 11) % 300];
+            auto expected = graph->dijkstra(source, target);
+            auto res = graph->bidirectionalDijkstra(source, target);
+            ASSERT_EQ(res.success, expected.success);
+            ASSERT_EQ(res.result, expected.result);
+            if (!res.success)
+            {
+                ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_TARGET_NODE_NOT_REACHABLE);
+                continue;
+            }
+            ASSERT_EQ(res.path.front(), source.getId());
+            ASSERT_EQ(res.path.back(), target.getId());
+            double length = 0;
+            for (std::size_t j = 0; j + 1 < res.path.size(); ++j)
+            {
+                double best = CXXGRAPH::INF_DOUBLE;
+                for (auto edge : graph->getEdgesBetween(*nodes[res.path[j]], *nodes[res.path[j + 1]]))
+                {
+                    best = std::min(best, dynamic_cast<const CXXGRAPH::Weighted *>(edge)->getWeight());
+                }
+                ASSERT_NE(best, CXXGRAPH::INF_DOUBLE);
+                length += best;
+            }
+            ASSERT_EQ(length, res.result);
+        }
+    }
+
+    auto res = directed.bidirectionalDijkstra(*nodes[3], *nodes[3]);
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.result, 0);
+    ASSERT_EQ(res.path, std::vector<unsigned long>{3});
+
+    CXXGRAPH::Node<int> outside(1000, 1000);
+    res = directed.bidirectionalDijkstra(outside, *nodes[3]);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_SOURCE_NODE_NOT_IN_GRAPH);
+    res = directed.bidirectionalDijkstra(*nodes[3], outside);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_TARGET_NODE_NOT_IN_GRAPH);
+
+    CXXGRAPH::DirectedEdge<int> unweighted(2000, *nodes[0], *nodes[1]);
+    CXXGRAPH::Graph<int> plain;
+    plain.addEdge(&unweighted);
+    res = plain.bidirectionalDijkstra(*nodes[0], *nodes[1]);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_NO_WEIGHTED_EDGE);
+}
+
+TEST(DijkstraTest, test_12)
+{
+    // A* on a weighted grid, node ( x, y ) has id y * SIDE + x
+    const unsigned long SIDE = 30;
+    std::mt19937 generator(3);
+    std::uniform_int_distribution<int> weightDistribution(1, 10);
+    std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+    for (unsigned long i = 0; i < SIDE * SIDE; ++i)
+    {
+        nodes.push_back(std::make_unique<CXXGRAPH::Node<int>>(i, i));
+    }
+    std::vector<std::unique_ptr<CXXGRAPH::UndirectedWeightedEdge<int>>> edges;
+    CXXGRAPH::Graph<int> graph;
+    for (unsigned long y = 0; y < SIDE; ++y)
+    {
+        for (unsigned long x = 0; x < SIDE; ++x)
+        {
+            if (x + 1 < SIDE)
+            {
+                edges.push_back(std::make_unique<CXXGRAPH::UndirectedWeightedEdge<int>>(edges.size(), *nodes[y * SIDE + x], *nodes[y * SIDE + x + 1], weightDistribution(generator)));
+                graph.addEdge(edges.back().get());
+            }
+            if (y + 1 < SIDE)
+            {
+                edges.push_back(std::make_unique<CXXGRAPH::UndirectedWeightedEdge<int>>(edges.size(), *nodes[y * SIDE + x], *nodes[(y + 1) * SIDE + x], weightDistribution(generator)));
+                graph.addEdge(edges.back().get());
+            }
+        }
+    }
+    for (unsigned long i = 0; i < SIDE * SIDE; i += 37)
+    {
+        auto &source = *nodes[i];
+        auto &target = *nodes[(i * 13 + 101) % (SIDE * SIDE)];
+        // the weights are at least 1, the manhattan distance is admissible
+        auto manhattan = [&target, SIDE](const CXXGRAPH::Node<int> &node)
+        {
+            double dx = std::abs(long(node.getId() % SIDE) - long(target.getId() % SIDE));
+            double dy = std::abs(long(node.getId() / SIDE) - long(target.getId() / SIDE));
+            return dx + dy;
+        };
+        // admissible but not consistent, some nodes are settled more than once
+        auto uneven = [&manhattan](const CXXGRAPH::Node<int> &node)
+        {
+            return node.getId() % 2 ? manhattan(node) : 0.0;
+        };
+        auto expected = graph.dijkstra(source, target);
+        ASSERT_TRUE(expected.success);
+        for (auto res : {graph.astar(source, target, manhattan), graph.astar(source, target, uneven),
+                         graph.astar(source, target, [](const CXXGRAPH::Node<int> &)
+                                     { return 0.0; })})
+        {
+            ASSERT_TRUE(res.success);
+            ASSERT_EQ(res.result, expected.result);
+            ASSERT_EQ(res.path.front(), source.getId());
+            ASSERT_EQ(res.path.back(), target.getId());
+            double length = 0;
+            for (std::size_t j = 0; j + 1 < res.path.size(); ++j)
+            {
+                auto between = graph.getEdgesBetween(*nodes[res.path[j]], *nodes[res.path[j + 1]]);
+                ASSERT_EQ(between.size(), 1);
+                length += dynamic_cast<const CXXGRAPH::Weighted *>(between.front())->getWeight();
+            }
+            ASSERT_EQ(length, res.result);
+        }
+    }
+
+    auto zero = [](const CXXGRAPH::Node<int> &)
+    { return 0.0; };
+    CXXGRAPH::Node<int> outside(5000, 5000);
+    auto res = graph.astar(outside, *nodes[0], zero);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_SOURCE_NODE_NOT_IN_GRAPH);
+    res = graph.astar(*nodes[0], outside, zero);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_TARGET_NODE_NOT_IN_GRAPH);
+
+    CXXGRAPH::DirectedWeightedEdge<int> oneWay(6000, *nodes[0], outside, 1);
+    graph.addEdge(&oneWay);
+    res = graph.astar(outside, *nodes[0], zero);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_TARGET_NODE_NOT_REACHABLE);
+
+    CXXGRAPH::DirectedEdge<int> unweighted(7000, *nodes[0], *nodes[1]);
+    CXXGRAPH::Graph_TS<int> plain;
+    plain.addEdge(&unweighted);
+    res = plain.astar(*nodes[0], *nodes[1], zero);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_NO_WEIGHTED_EDGE);
+}
+
+TEST(DijkstraTest, test_13)
+{
+    // dijkstra with the radix heap finds the distances of dial and dijkstra
+    std::mt19937 generator(13);
+    std::uniform_int_distribution<unsigned long> nodeDistribution(0, 999);
+    std::uniform_int_distribution<int> weightDistribution(0, 50);
+    std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+    for (int i = 0; i < 1000; ++i)
+    {
+        nodes.push_back(std::make_unique<CXXGRAPH::Node<int>>(i, i));
+    }
+    std::vector<std::unique_ptr<CXXGRAPH::Edge<int>>> edges;
+    CXXGRAPH::Graph<int> graph;
+    for (unsigned long i = 0; i < 4000; ++i)
+    {
+        auto &from = *nodes[nodeDistribution(generator)];
+        auto &to = *nodes[nodeDistribution(generator)];
+        if (i % 2)
+        {
+            edges.push_back(std::make_unique<CXXGRAPH::DirectedWeightedEdge<int>>(i, from, to, weightDistribution(generator)));
+        }
+        else
+        {
+            edges.push_back(std::make_unique<CXXGRAPH::UndirectedWeightedEdge<int>>(i, from, to, weightDistribution(generator)));
+        }
+        graph.addEdge(edges.back().get());
+    }
+    for (unsigned long source : {0ul, 17ul, 512ul})
+    {
+        auto res = graph.radixDijkstra(*nodes[source]);
+        auto dial = graph.dial(*nodes[source], 50);
+        auto expected = graph.dijkstraAll(*nodes[source]);
+        ASSERT_TRUE(res.success);
+        ASSERT_EQ(res.errorMessage, "");
+        ASSERT_EQ(res.nodeIds, dial.nodeIds);
+        ASSERT_EQ(res.distances, dial.distances);
+        ASSERT_EQ(res.nodeIds, expected.nodeIds);
+        for (std::size_t i = 0; i < res.distances.size(); ++i)
+        {
+            if (expected.distances[i] != CXXGRAPH::INF_DOUBLE)
+            {
+                ASSERT_EQ(res.distances[i], expected.distances[i]);
+            }
+        }
+    }
+
+    CXXGRAPH::Node<int> outside(5000, 5000);
+    auto res = graph.radixDijkstra(outside);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_SOURCE_NODE_NOT_IN_GRAPH);
+    ASSERT_TRUE(res.nodeIds.empty());
+
+    CXXGRAPH::DirectedWeightedEdge<int> negative(6000, *nodes[0], *nodes[1], -1);
+    CXXGRAPH::DirectedEdge<int> unweighted(7000, *nodes[0], *nodes[1]);
+    CXXGRAPH::Graph_TS<int> plain;
+    plain.addEdge(&negative);
+    res = plain.radixDijkstra(*nodes[0]);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_WEIGHT_OUT_OF_RANGE);
+    plain.removeEdge(6000);
+    plain.addEdge(&unweighted);
+    res = plain.radixDijkstra(*nodes[0]);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_NO_WEIGHTED_EDGE);
+
+    // a weight that is not an integer is reported, not truncated
+    CXXGRAPH::DirectedWeightedEdge<int> fractional(8000, *nodes[0], *nodes[1], 2.7);
+    plain.removeEdge(7000);
+    plain.addEdge(&fractional);
+    res = plain.radixDijkstra(*nodes[0]);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_WEIGHT_OUT_OF_RANGE);
+}
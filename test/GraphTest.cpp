@@ -1,3 +1,4 @@
+#include <thread>
 #include "gtest/gtest.h"
 #include "CXXGraph.hpp"
 
@@ -49,6 +50,340 @@ TEST(GraphTest, GetEdge_3)
     ASSERT_EQ(*(graph.getEdge(1).value()), edge);
 }
 
+TEST(GraphTest, AddEdge_1)
+{
+    CXXGRAPH::Node<int> node1(1, 1);
+    CXXGRAPH::Node<int> node2(2, 2);
+    CXXGRAPH::Node<int> node3(3, 3);
+    CXXGRAPH::DirectedEdge<int> edge1(1, node1, node2);
+    CXXGRAPH::DirectedEdge<int> edge2(2, node2, node3);
+    CXXGRAPH::Graph<int> graph;
+    graph.addEdge(&edge1);
+    graph.addEdge(&edge2);
+    graph.addEdge(&edge1);
+    ASSERT_EQ(graph.getEdgeSet().size(), 2);
+    ASSERT_EQ(graph.getEdge(2).value(), &edge2);
+}
+
+TEST(GraphTest, AddEdges_1)
+{
+    CXXGRAPH::Node<int> node1(1, 1);
+    CXXGRAPH::Node<int> node2(2, 2);
+    CXXGRAPH::Node<int> node3(3, 3);
+    CXXGRAPH::DirectedEdge<int> edge1(1, node1, node2);
+    CXXGRAPH::DirectedEdge<int> edge2(2, node2, node3);
+    CXXGRAPH::UndirectedEdge<int> edge3(3, node1, node3);
+    CXXGRAPH::Graph<int> graph;
+    graph.addEdge(&edge1);
+    auto compact = graph.freeze();
+    // duplicates inside the batch and already in the graph are discarded
+    std::vector<const CXXGRAPH::Edge<int> *> batch = {&edge2, &edge1, &edge3, &edge2};
+    graph.addEdges(batch);
+    ASSERT_EQ(graph.getEdgeSet().size(), 3);
+    ASSERT_EQ(graph.getNodeSet().size(), 3);
+    ASSERT_NE(compact, graph.freeze());
+    std::list<const CXXGRAPH::Edge<int> *> edgeList = {&edge3, &edge1};
+    CXXGRAPH::Graph_TS<int> graph_ts;
+    graph_ts.addEdges(edgeList.begin(), edgeList.end());
+    ASSERT_EQ(graph_ts.getEdgeSet().size(), 2);
+    ASSERT_EQ(graph_ts.getEdgeSet().front(), &edge3);
+}
+
+TEST(GraphTest, RemoveEdge_1)
+{
+    CXXGRAPH::Node<int> node1(1, 1);
+    CXXGRAPH::Node<int> node2(2, 2);
+    CXXGRAPH::Node<int> node3(3, 3);
+    CXXGRAPH::DirectedEdge<int> edge1(1, node1, node2);
+    CXXGRAPH::DirectedEdge<int> edge2(2, node2, node3);
+    std::list<const CXXGRAPH::Edge<int> *> edgeSet;
+    edgeSet.push_back(&edge1);
+    edgeSet.push_back(&edge2);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    graph.removeEdge(1);
+    graph.removeEdge(3);
+    ASSERT_EQ(graph.getEdgeSet().size(), 1);
+    ASSERT_FALSE(graph.getEdge(1).has_value());
+    ASSERT_TRUE(graph.getEdge(2).has_value());
+    graph.addEdge(&edge1);
+    ASSERT_EQ(graph.getEdgeSet().size(), 2);
+    ASSERT_TRUE(graph.getEdge(1).has_value());
+}
+
+TEST(GraphTest, Copy_1)
+{
+    CXXGRAPH::Node<int> node1(1, 1);
+    CXXGRAPH::Node<int> node2(2, 2);
+    CXXGRAPH::Node<int> node3(3, 3);
+    CXXGRAPH::DirectedEdge<int> edge1(1, node1, node2);
+    CXXGRAPH::DirectedEdge<int> edge2(2, node2, node3);
+    std::list<const CXXGRAPH::Edge<int> *> edgeSet;
+    edgeSet.push_back(&edge1);
+    edgeSet.push_back(&edge2);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    CXXGRAPH::Graph<int> copy(graph);
+    copy.removeEdge(1);
+    ASSERT_EQ(graph.getEdgeSet().size(), 2);
+    ASSERT_EQ(copy.getEdgeSet().size(), 1);
+    ASSERT_TRUE(graph.getEdge(1).has_value());
+    ASSERT_FALSE(copy.getEdge(1).has_value());
+}
+
+TEST(GraphTest, Move_1)
+{
+    CXXGRAPH::Node<int> node1(1, 1);
+    CXXGRAPH::Node<int> node2(2, 2);
+    CXXGRAPH::Node<int> node3(3, 3);
+    CXXGRAPH::DirectedEdge<int> edge1(1, node1, node2);
+    CXXGRAPH::DirectedEdge<int> edge2(2, node2, node3);
+    std::list<const CXXGRAPH::Edge<int> *> edgeSet;
+    edgeSet.push_back(&edge1);
+    edgeSet.push_back(&edge2);
+    edgeSet.push_back(&edge1);
+    // the list is taken over and the duplicate is dropped
+    CXXGRAPH::Graph<int> graph(std::move(edgeSet));
+    ASSERT_EQ(graph.getEdgeSet().size(), 2);
+    CXXGRAPH::Graph<int> moved(std::move(graph));
+    ASSERT_EQ(graph.getEdgeSet().size(), 0);
+    ASSERT_EQ(graph.getNodeSet().size(), 0);
+    ASSERT_EQ(moved.getEdgeSet().size(), 2);
+    ASSERT_EQ(moved.getNodeSet().size(), 3);
+    // the indexes moved with the lists, so removal and lookup still work
+    moved.removeEdge(1);
+    ASSERT_FALSE(moved.getEdge(1).has_value());
+    ASSERT_TRUE(moved.getEdge(2).has_value());
+    CXXGRAPH::Graph<int> assigned;
+    assigned = std::move(moved);
+    ASSERT_EQ(assigned.getEdgeSet().size(), 1);
+    ASSERT_EQ(moved.getEdgeSet().size(), 0);
+    ASSERT_EQ(assigned.breadth_first_search(node2).size(), 2);
+    CXXGRAPH::Graph_TS<int> graph_ts(std::move(assigned));
+    ASSERT_EQ(graph_ts.getEdgeSet().size(), 1);
+    ASSERT_EQ(assigned.getEdgeSet().size(), 0);
+}
+
+TEST(GraphTest, Owning_1)
+{
+    CXXGRAPH::Graph<int> copy;
+    {
+        CXXGRAPH::Graph<int> graph;
+        auto node1 = graph.createNode(1, 1);
+        auto node2 = graph.createNode(2, 2);
+        auto edge = graph.addEdge(std::make_unique<CXXGRAPH::DirectedWeightedEdge<int>>(1, *node1, *node2, 3.0));
+        ASSERT_NE(edge, nullptr);
+        // a duplicate is discarded and destroyed
+        ASSERT_EQ(graph.addEdge(std::make_unique<CXXGRAPH::DirectedWeightedEdge<int>>(1, *node1, *node2, 3.0)), nullptr);
+        ASSERT_EQ(graph.getEdgeSet().size(), 1);
+        copy = graph;
+    }
+    // the copy share the ownership of the Nodes and Edges
+    ASSERT_EQ(copy.getEdgeSet().size(), 1);
+    auto node1 = copy.getNode(1);
+    auto node2 = copy.getNode(2);
+    ASSERT_TRUE(node1.has_value() && node2.has_value());
+    auto res = copy.dijkstra(*node1.value(), *node2.value());
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.result, 3.0);
+}
+
+TEST(GraphTest, Owning_2)
+{
+    // the copies of a Graph_TS allocate from their own arena, they can create Nodes and Edges concurrently
+    CXXGRAPH::Graph_TS<int> graph;
+    auto node1 = graph.createNode(1, 1);
+    auto node2 = graph.createNode(2, 2);
+    graph.addEdge(std::make_unique<CXXGRAPH::DirectedWeightedEdge<int>>(1, *node1, *node2, 1.0));
+    auto copy = std::make_unique<CXXGRAPH::Graph_TS<int>>(*graph.snapshot());
+    CXXGRAPH::Graph_TS<int> other(*copy->snapshot());
+    auto fill = [](CXXGRAPH::Graph_TS<int> &target)
+    {
+        for (unsigned long i = 10; i < 1000; ++i)
+        {
+            auto from = target.createNode(i, int(i));
+            auto to = target.createNode(i + 1, int(i + 1));
+            target.addEdge(std::make_unique<CXXGRAPH::DirectedWeightedEdge<int>>(i, *from, *to, 1.0));
+        }
+    };
+    std::thread first(fill, std::ref(graph));
+    std::thread second(fill, std::ref(*copy));
+    fill(other);
+    first.join();
+    second.join();
+    ASSERT_EQ(graph.getEdgeSet().size(), 991);
+    ASSERT_EQ(copy->getEdgeSet().size(), 991);
+    // the Nodes copied from the first Graph outlive the copy they have been taken from
+    copy.reset();
+    ASSERT_EQ(other.getEdgeSet().size(), 991);
+    auto res = other.dijkstra(*other.getNode(1).value(), *other.getNode(2).value());
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.result, 1.0);
+}
+
+TEST(GraphTest, Snapshot_1)
+{
+    std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+    std::vector<std::unique_ptr<CXXGRAPH::DirectedWeightedEdge<int>>> edges;
+    for (int i = 0; i < 1000; ++i)
+    {
+        nodes.push_back(std::make_unique<CXXGRAPH::Node<int>>(i, i));
+    }
+    for (int i = 0; i + 1 < 1000; ++i)
+    {
+        edges.push_back(std::make_unique<CXXGRAPH::DirectedWeightedEdge<int>>(i, *nodes[i], *nodes[i + 1], 1));
+    }
+    CXXGRAPH::Graph_TS<int> graph;
+    graph.addEdge(edges[0].get());
+    auto version = graph.getVersion();
+    auto first = graph.snapshot();
+    // the same version share the same snapshot
+    ASSERT_EQ(first.get(), graph.snapshot().get());
+    ASSERT_EQ(first->getEdgeSet().size(), 1);
+    std::thread writer([&graph, &edges]()
+                       {
+                           for (std::size_t i = 1; i < edges.size(); ++i)
+                           {
+                               graph.addEdge(edges[i].get());
+                           } });
+    // the reader traverse its version without locks while the writer updates the Graph
+    for (int i = 0; i < 100; ++i)
+    {
+        auto current = graph.snapshot();
+        auto res = current->breadth_first_search(*nodes[0]);
+        ASSERT_EQ(res.size(), current->getEdgeSet().size() + 1);
+    }
+    writer.join();
+    ASSERT_EQ(first->getEdgeSet().size(), 1);
+    ASSERT_GT(graph.getVersion(), version);
+    auto last = graph.snapshot();
+    ASSERT_NE(first.get(), last.get());
+    ASSERT_EQ(last->getEdgeSet().size(), 999);
+    ASSERT_EQ(last->dijkstra(*nodes[0], *nodes[999]).result, 999);
+}
+
+TEST(GraphTest, Snapshot_2)
+{
+    std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+    std::vector<std::unique_ptr<CXXGRAPH::DirectedWeightedEdge<int>>> edges;
+    for (int i = 0; i < 100; ++i)
+    {
+        nodes.push_back(std::make_unique<CXXGRAPH::Node<int>>(i, i));
+    }
+    for (int i = 0; i + 1 < 100; ++i)
+    {
+        edges.push_back(std::make_unique<CXXGRAPH::DirectedWeightedEdge<int>>(i, *nodes[i], *nodes[i + 1], 1));
+    }
+    CXXGRAPH::Graph_TS<int> graph;
+    for (const auto &edge : edges)
+    {
+        graph.addEdge(edge.get());
+    }
+    ASSERT_FALSE(graph.isCompressedAdjacency());
+    auto current = graph.snapshot();
+    // the compressed snapshot is built with the snapshot, the readers only share it
+    std::shared_ptr<const CXXGRAPH::CompressedGraph<int>> first;
+    std::shared_ptr<const CXXGRAPH::CompressedGraph<int>> second;
+    std::thread reader([&current, &first]()
+                       { first = current->freezeCompressed(); });
+    second = current->freezeCompressed();
+    reader.join();
+    ASSERT_EQ(first.get(), second.get());
+    ASSERT_EQ(first->getNumberOfLinks(), 99);
+    // a rejected duplicate does not publish a new version
+    auto version = graph.getVersion();
+    ASSERT_EQ(graph.addEdge(std::make_unique<CXXGRAPH::DirectedWeightedEdge<int>>(0, *nodes[0], *nodes[1], 1)), nullptr);
+    ASSERT_EQ(graph.getVersion(), version);
+    ASSERT_EQ(graph.snapshot().get(), current.get());
+}
+
+TEST(GraphTest, HasEdge_1)
+{
+    CXXGRAPH::Node<int> node1(1, 1);
+    CXXGRAPH::Node<int> node2(2, 2);
+    CXXGRAPH::Node<int> node3(3, 3);
+    CXXGRAPH::Node<int> other1(1, 10);
+    CXXGRAPH::DirectedEdge<int> edge1(1, node1, node2);
+    CXXGRAPH::UndirectedEdge<int> edge2(2, node2, node3);
+    CXXGRAPH::DirectedEdge<int> edge3(3, node1, node2);
+    CXXGRAPH::Edge<int> edge4(4, node3, node1);
+    std::list<const CXXGRAPH::Edge<int> *> edgeSet;
+    edgeSet.push_back(&edge1);
+    edgeSet.push_back(&edge2);
+    edgeSet.push_back(&edge3);
+    edgeSet.push_back(&edge4);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    ASSERT_TRUE(graph.hasEdge(node1, node2));
+    ASSERT_FALSE(graph.hasEdge(node2, node1));
+    // an Undirected Edge link its Nodes in both directions
+    ASSERT_TRUE(graph.hasEdge(node2, node3));
+    ASSERT_TRUE(graph.hasEdge(node3, node2));
+    // a simple Edge has no direction, so it does not link its Nodes
+    ASSERT_FALSE(graph.hasEdge(node3, node1));
+    // a Node with the same id but different data is another Node
+    ASSERT_FALSE(graph.hasEdge(other1, node2));
+    auto between = graph.getEdgesBetween(node1, node2);
+    ASSERT_EQ(between.size(), 2);
+    ASSERT_TRUE(std::find(between.begin(), between.end(), &edge3) != between.end());
+    graph.removeEdge(1);
+    ASSERT_TRUE(graph.hasEdge(node1, node2));
+    graph.removeEdge(3);
+    ASSERT_FALSE(graph.hasEdge(node1, node2));
+    ASSERT_EQ(graph.getEdgesBetween(node1, node2).size(), 0);
+    CXXGRAPH::Graph<int> copy(graph);
+    graph.removeEdge(2);
+    ASSERT_FALSE(graph.hasEdge(node3, node2));
+    ASSERT_TRUE(copy.hasEdge(node3, node2));
+    CXXGRAPH::Graph_TS<int> graph_ts(std::move(copy));
+    ASSERT_TRUE(graph_ts.hasEdge(node2, node3));
+    ASSERT_EQ(graph_ts.getEdgesBetween(node3, node2).size(), 1);
+}
+
+TEST(GraphTest, Neighbors_1)
+{
+    CXXGRAPH::Node<int> node1(1, 1);
+    CXXGRAPH::Node<int> node2(2, 2);
+    CXXGRAPH::Node<int> node3(3, 3);
+    CXXGRAPH::Node<int> node4(4, 4);
+    CXXGRAPH::DirectedWeightedEdge<int> edge1(1, node1, node2, 5);
+    CXXGRAPH::UndirectedEdge<int> edge2(2, node1, node3);
+    CXXGRAPH::DirectedEdge<int> edge3(3, node4, node1);
+    std::list<const CXXGRAPH::Edge<int> *> edgeSet;
+    edgeSet.push_back(&edge1);
+    edgeSet.push_back(&edge2);
+    edgeSet.push_back(&edge3);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    std::vector<const CXXGRAPH::Node<int> *> visited;
+    double totalWeight = 0;
+    graph.forEachNeighbor(node1, [&](const CXXGRAPH::Node<int> *neighbor, const CXXGRAPH::Edge<int> *edge, double weight)
+                          {
+                              visited.push_back(neighbor);
+                              totalWeight += weight;
+                              ASSERT_TRUE(edge == &edge1 || edge == &edge2); });
+    ASSERT_EQ(visited, std::vector<const CXXGRAPH::Node<int> *>({&node2, &node3}));
+    ASSERT_EQ(totalWeight, 5);
+
+    auto range = graph.neighbors(node1);
+    ASSERT_EQ(range.size(), 2);
+    std::vector<const CXXGRAPH::Edge<int> *> rangeEdges;
+    for (const auto &neighbor : range)
+    {
+        rangeEdges.push_back(neighbor.edge);
+    }
+    ASSERT_EQ(rangeEdges, std::vector<const CXXGRAPH::Edge<int> *>({&edge1, &edge2}));
+    // the range holds its snapshot, so it is not affected by later changes
+    graph.removeEdge(2);
+    ASSERT_EQ(std::distance(range.begin(), range.end()), 2);
+    ASSERT_EQ(graph.neighbors(node1).size(), 1);
+    ASSERT_TRUE(graph.neighbors(node2).empty());
+    ASSERT_TRUE(graph.neighbors(CXXGRAPH::Node<int>(5, 5)).empty());
+
+    CXXGRAPH::Graph_TS<int> graph_ts(edgeSet);
+    std::size_t count = 0;
+    graph_ts.forEachNeighbor(node3, [&count](const CXXGRAPH::Node<int> *neighbor, const CXXGRAPH::Edge<int> *, double)
+                             { count += neighbor->getId() == 1; });
+    ASSERT_EQ(count, 1);
+    ASSERT_EQ((*graph_ts.neighbors(node4).begin()).node, &node1);
+}
+
 TEST(GraphTest, GetNodeSet_1)
 {
     CXXGRAPH::Node<int> node1(1, 1);
@@ -83,6 +418,382 @@ TEST(GraphTest, GetNodeSet_2)
     ASSERT_TRUE(std::find(nodeSet.begin(), nodeSet.end(),&node3) != nodeSet.end());
 }
 
+TEST(GraphTest, GetNode_1)
+{
+    CXXGRAPH::Node<int> node1(1, 1);
+    CXXGRAPH::Node<int> node2(2, 2);
+    CXXGRAPH::Node<int> node3(3, 3);
+    CXXGRAPH::DirectedEdge<int> edge1(1, node1, node2);
+    CXXGRAPH::DirectedEdge<int> edge2(2, node2, node3);
+    std::list<const CXXGRAPH::Edge<int> *> edgeSet;
+    edgeSet.push_back(&edge1);
+    edgeSet.push_back(&edge2);
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    ASSERT_EQ(graph.getNode(2).value(), &node2);
+    ASSERT_FALSE(graph.getNode(4).has_value());
+    // node2 is still referenced by edge2
+    graph.removeEdge(1);
+    ASSERT_FALSE(graph.getNode(1).has_value());
+    ASSERT_TRUE(graph.getNode(2).has_value());
+    ASSERT_EQ(graph.getNodeSet().size(), 2);
+    graph.removeEdge(2);
+    ASSERT_FALSE(graph.getNode(2).has_value());
+    ASSERT_TRUE(graph.getNodeSet().empty());
+}
+
+TEST(GraphTest, AdjMatrix_1)
+{
+    CXXGRAPH::Node<int> node1(1, 1);
+    CXXGRAPH::Node<int> node2(2, 2);
+    CXXGRAPH::Node<int> node3(3, 3);
+    CXXGRAPH::DirectedEdge<int> edge1(1, node1, node2);
+    CXXGRAPH::UndirectedEdge<int> edge2(2, node2, node3);
+    CXXGRAPH::Graph<int> graph;
+    graph.addEdge(&edge1);
+    const CXXGRAPH::AdjacencyMatrix<int> &adj = graph.getAdjMatrixRef();
+    ASSERT_EQ(adj.size(), 1);
+    graph.addEdge(&edge2);
+    ASSERT_EQ(adj.size(), 3);
+    ASSERT_EQ(adj.at(&node2).size(), 1);
+    ASSERT_EQ(adj.at(&node2).front().first, &node3);
+    ASSERT_EQ(adj.at(&node3).front().second, &edge2);
+    graph.removeEdge(1);
+    ASSERT_EQ(adj.size(), 2);
+    ASSERT_TRUE(adj.find(&node1) == adj.end());
+    ASSERT_EQ(graph.getAdjMatrix(), adj);
+}
+
+TEST(GraphTest, Tombstone_1)
+{
+    CXXGRAPH::Node<int> node1(1, 1);
+    CXXGRAPH::Node<int> node2(2, 2);
+    CXXGRAPH::Node<int> node3(3, 3);
+    CXXGRAPH::Node<int> node4(4, 4);
+    CXXGRAPH::DirectedWeightedEdge<int> edge1(1, node1, node2, 1);
+    CXXGRAPH::DirectedWeightedEdge<int> edge2(2, node2, node3, 1);
+    CXXGRAPH::UndirectedWeightedEdge<int> edge3(3, node1, node3, 5);
+    CXXGRAPH::DirectedWeightedEdge<int> edge4(4, node3, node4, 1);
+    std::list<const CXXGRAPH::Edge<int> *> edgeSet = {&edge1, &edge2, &edge3, &edge4};
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    graph.setTombstoneRemoval(true);
+    graph.setCompactionThreshold(0.9);
+    auto compact = graph.freeze();
+    ASSERT_EQ(graph.dijkstra(node1, node3).result, 2);
+    // the removed Edge is skipped, without rebuilding the snapshot
+    graph.removeEdge(2);
+    ASSERT_EQ(graph.getNumberOfTombstones(), 1);
+    ASSERT_EQ(graph.dijkstra(node1, node3).result, 5);
+    ASSERT_EQ(graph.breadth_first_search(node2).size(), 1);
+    // the undirected Edge has two dead links and node4 is no more in the graph
+    graph.removeEdge(4);
+    graph.removeEdge(3);
+    ASSERT_EQ(graph.getNumberOfTombstones(), 4);
+    ASSERT_EQ(graph.dijkstra(node1, node4).errorMessage, CXXGRAPH::ERR_TARGET_NODE_NOT_IN_GRAPH);
+    ASSERT_EQ(graph.dial(node1, 5).nodeIds.size(), 2);
+    ASSERT_FALSE(graph.isCyclicDirectedGraphBFS());
+    // freeze gives a snapshot without dead links
+    auto compacted = graph.freeze();
+    ASSERT_NE(compact, compacted);
+    ASSERT_EQ(graph.getNumberOfTombstones(), 0);
+    ASSERT_EQ(compacted->getNumberOfLinks(), 1);
+}
+
+TEST(GraphTest, Tombstone_2)
+{
+    CXXGRAPH::Node<int> node1(1, 1);
+    CXXGRAPH::Node<int> node2(2, 2);
+    CXXGRAPH::Node<int> node3(3, 3);
+    CXXGRAPH::DirectedEdge<int> edge1(1, node1, node2);
+    CXXGRAPH::DirectedEdge<int> edge2(2, node2, node3);
+    CXXGRAPH::DirectedEdge<int> edge3(3, node3, node1);
+    std::list<const CXXGRAPH::Edge<int> *> edgeSet = {&edge1, &edge2, &edge3};
+    CXXGRAPH::Graph_TS<int> graph(edgeSet);
+    graph.setTombstoneRemoval(true);
+    graph.setCompactionThreshold(0.5);
+    ASSERT_EQ(graph.depth_first_search(node1).size(), 3);
+    graph.removeEdge(3);
+    ASSERT_EQ(graph.getNumberOfTombstones(), 1);
+    ASSERT_EQ(graph.depth_first_search(node3).size(), 1);
+    // the second removal crosses the threshold and compacts the snapshot
+    graph.removeEdge(1);
+    ASSERT_EQ(graph.getNumberOfTombstones(), 0);
+    ASSERT_EQ(graph.freeze()->getNumberOfLinks(), 1);
+}
+
+TEST(GraphTest, Tombstone_3)
+{
+    // the compressed snapshot rebuilt after a removal in tombstone mode has not the removed Edge
+    CXXGRAPH::Node<int> node1(1, 1);
+    CXXGRAPH::Node<int> node2(2, 2);
+    CXXGRAPH::Node<int> node3(3, 3);
+    CXXGRAPH::Node<int> node4(4, 4);
+    CXXGRAPH::DirectedWeightedEdge<int> edge1(1, node1, node2, 1);
+    CXXGRAPH::DirectedWeightedEdge<int> edge2(2, node2, node3, 1);
+    CXXGRAPH::DirectedWeightedEdge<int> edge3(3, node1, node4, 1);
+    std::list<const CXXGRAPH::Edge<int> *> edgeSet = {&edge1, &edge2, &edge3};
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    graph.setTombstoneRemoval(true);
+    graph.setCompactionThreshold(0.9);
+    graph.setCompressedAdjacency(true);
+    graph.freeze();
+    ASSERT_EQ(graph.breadth_first_search(node1).size(), 4);
+    graph.removeEdge(1);
+    ASSERT_EQ(graph.getNumberOfTombstones(), 1);
+    ASSERT_EQ(graph.breadth_first_search(node1).size(), 2);
+    ASSERT_EQ(graph.depth_first_search(node1).size(), 2);
+    auto res = graph.dijkstra(node1, node2);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_TARGET_NODE_NOT_REACHABLE);
+    res = graph.astar(node1, node2, [](const CXXGRAPH::Node<int> &)
+                      { return 0.0; });
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_TARGET_NODE_NOT_REACHABLE);
+    auto all = graph.dijkstraAll(node1);
+    ASSERT_TRUE(all.success);
+    auto batch = graph.dijkstraBatch({&node1}, {&node2, &node4});
+    ASSERT_TRUE(batch.success);
+    ASSERT_EQ(batch.distances, (std::vector<double>{CXXGRAPH::INF_DOUBLE, 1}));
+    auto radix = graph.radixDijkstra(node1);
+    ASSERT_TRUE(radix.success);
+    auto delta = graph.deltaStepping(node1, 1, 2);
+    ASSERT_TRUE(delta.success);
+    for (std::size_t i = 0; i < all.nodeIds.size(); ++i)
+    {
+        if (all.nodeIds[i] == 2 || all.nodeIds[i] == 3)
+        {
+            ASSERT_EQ(all.distances[i], CXXGRAPH::INF_DOUBLE);
+        }
+    }
+    for (std::size_t i = 0; i < radix.nodeIds.size(); ++i)
+    {
+        if (radix.nodeIds[i] == 2 || radix.nodeIds[i] == 3)
+        {
+            ASSERT_EQ(radix.distances[i], std::numeric_limits<long>::max());
+            ASSERT_EQ(delta.distances[i], CXXGRAPH::INF_DOUBLE);
+        }
+    }
+    // the CSR snapshot keeps its tombstones
+    ASSERT_EQ(graph.getNumberOfTombstones(), 1);
+}
+
+TEST(GraphTest, Tombstone_5)
+{
+    // switching the compressed mode drops the tombstones with the CSR snapshot
+    CXXGRAPH::Node<int> node1(1, 1);
+    CXXGRAPH::Node<int> node2(2, 2);
+    CXXGRAPH::Node<int> node3(3, 3);
+    CXXGRAPH::Node<int> node4(4, 4);
+    CXXGRAPH::DirectedWeightedEdge<int> edge1(1, node1, node2, 1);
+    CXXGRAPH::DirectedWeightedEdge<int> edge2(2, node2, node3, 1);
+    CXXGRAPH::DirectedWeightedEdge<int> edge3(3, node1, node3, 1);
+    CXXGRAPH::DirectedWeightedEdge<int> edge4(4, node1, node4, 1);
+    CXXGRAPH::DirectedWeightedEdge<int> edge5(5, node4, node3, 1);
+    std::list<const CXXGRAPH::Edge<int> *> edgeSet = {&edge1, &edge2, &edge3, &edge4, &edge5};
+    CXXGRAPH::Graph<int> graph(edgeSet);
+    graph.setTombstoneRemoval(true);
+    graph.setCompactionThreshold(0.9);
+    ASSERT_EQ(graph.breadth_first_search(node1).size(), 4);
+    graph.removeEdge(1);
+    ASSERT_EQ(graph.getNumberOfTombstones(), 1);
+    graph.setCompressedAdjacency(true);
+    graph.setCompressedAdjacency(false);
+    ASSERT_EQ(graph.getNumberOfTombstones(), 0);
+    ASSERT_EQ(graph.breadth_first_search(node2).size(), 2);
+    ASSERT_EQ(graph.getInDegree(node3), 3);
+    graph.removeEdge(3);
+    graph.setCompressedAdjacency(true);
+    ASSERT_EQ(graph.getNumberOfTombstones(), 0);
+    ASSERT_EQ(graph.breadth_first_search(node1).size(), 3);
+    ASSERT_EQ(graph.getInDegree(node3), 2);
+}
+
+TEST(GraphTest, Tombstone_4)
+{
+    // the neighbor queries skip the dead links without compacting the snapshot
+    CXXGRAPH::Node<int> node1(1, 1);
+    CXXGRAPH::Node<int> node2(2, 2);
+    CXXGRAPH::Node<int> node3(3, 3);
+    CXXGRAPH::DirectedWeightedEdge<int> edge1(1, node1, node2, 1);
+    CXXGRAPH::DirectedWeightedEdge<int> edge2(2, node1, node3, 2);
+    CXXGRAPH::UndirectedWeightedEdge<int> edge3(3, node2, node3, 3);
+    std::list<const CXXGRAPH::Edge<int> *> edgeSet = {&edge1, &edge2, &edge3};
+    CXXGRAPH::Graph_TS<int> graph(edgeSet);
+    graph.setTombstoneRemoval(true);
+    graph.setCompactionThreshold(0.9);
+    auto compact = graph.freeze();
+    graph.removeEdge(1);
+    graph.removeEdge(3);
+    ASSERT_EQ(graph.getNumberOfTombstones(), 3);
+    auto range = graph.neighbors(node1);
+    ASSERT_EQ(range.size(), 1);
+    ASSERT_EQ((*range.begin()).node, &node3);
+    ASSERT_EQ((*range.begin()).weight, 2);
+    std::size_t count = 0;
+    graph.forEachNeighbor(node1, [&count](const CXXGRAPH::Node<int> *, const CXXGRAPH::Edge<int> *edge, double)
+                          {
+                              ASSERT_EQ(edge->getId(), 2);
+                              ++count; });
+    ASSERT_EQ(count, 1);
+    ASSERT_TRUE(graph.neighbors(node2).empty());
+    ASSERT_TRUE(graph.neighbors(node3).empty());
+    // the A* search of a Graph_TS skips the dead links as well
+    auto zero = [](const CXXGRAPH::Node<int> &)
+    { return 0.0; };
+    auto res = graph.astar(node1, node3, zero);
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.result, 2);
+    // no live link is left to the Node 2
+    res = graph.astar(node1, node2, zero);
+    ASSERT_FALSE(res.success);
+    ASSERT_EQ(res.errorMessage, CXXGRAPH::ERR_TARGET_NODE_NOT_IN_GRAPH);
+    // dijkstraAll leaves out the Node 2, and the predecessors point to the kept positions
+    auto all = graph.dijkstraAll(node1);
+    ASSERT_TRUE(all.success);
+    ASSERT_EQ(all.nodeIds.size(), 2);
+    ASSERT_EQ(all.distances.size(), 2);
+    for (std::size_t i = 0; i < all.nodeIds.size(); ++i)
+    {
+        ASSERT_NE(all.nodeIds[i], 2);
+        ASSERT_EQ(all.nodeIds[all.predecessors[i]], 1);
+        ASSERT_EQ(all.distances[i], all.nodeIds[i] == 1 ? 0 : 2);
+    }
+    ASSERT_EQ(graph.getNumberOfTombstones(), 3);
+    ASSERT_EQ(graph.freeze()->getNumberOfLinks(), 1);
+}
+
+TEST(GraphTest, Append_1)
+{
+    // the traversals after an insertion read the appended links next to the CSR snapshot, without rebuilding it
+    std::vector<std::unique_ptr<CXXGRAPH::Node<int>>> nodes;
+    std::vector<std::unique_ptr<CXXGRAPH::DirectedWeightedEdge<int>>> edges;
+    for (int i = 0; i < 22; ++i)
+    {
+        nodes.push_back(std::make_unique<CXXGRAPH::Node<int>>(i, i));
+    }
+    CXXGRAPH::Graph<int> graph;
+    for (int i = 0; i + 2 < 22; ++i)
+    {
+        edges.push_back(std::make_unique<CXXGRAPH::DirectedWeightedEdge<int>>(i, *nodes[i], *nodes[i + 1], 1));
+        graph.addEdge(edges.back().get());
+    }
+    ASSERT_EQ(graph.breadth_first_search(*nodes[0]).size(), 21);
+    ASSERT_EQ(graph.getNumberOfAppendedLinks(), 0);
+    // an Edge to a Node new to the snapshot, and an Undirected shortcut
+    CXXGRAPH::DirectedWeightedEdge<int> edge1(100, *nodes[20], *nodes[21], 1);
+    CXXGRAPH::UndirectedWeightedEdge<int> edge2(101, *nodes[0], *nodes[5], 2);
+    graph.addEdge(&edge1);
+    ASSERT_EQ(graph.getNumberOfAppendedLinks(), 1);
+    ASSERT_EQ(graph.breadth_first_search(*nodes[0]).size(), 22);
+    graph.addEdge(&edge2);
+    ASSERT_EQ(graph.getNumberOfAppendedLinks(), 3);
+    auto res = graph.dijkstra(*nodes[0], *nodes[21]);
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.result, 18);
+    ASSERT_EQ(graph.bidirectionalDijkstra(*nodes[0], *nodes[21]).result, 18);
+    ASSERT_EQ(graph.dijkstra(*nodes[5], *nodes[0]).result, 2);
+    ASSERT_EQ(graph.depth_first_search(*nodes[21]).size(), 1);
+    auto all = graph.dijkstraAll(*nodes[0]);
+    ASSERT_TRUE(all.success);
+    ASSERT_EQ(all.nodeIds.size(), 22);
+    ASSERT_EQ(graph.getNumberOfAppendedLinks(), 3);
+
+    // an appended Edge removed in tombstone mode is a dead link
+    graph.setTombstoneRemoval(true);
+    graph.setCompactionThreshold(0.9);
+    graph.removeEdge(100);
+    ASSERT_EQ(graph.getNumberOfTombstones(), 1);
+    ASSERT_EQ(graph.breadth_first_search(*nodes[0]).size(), 21);
+    ASSERT_FALSE(graph.dijkstra(*nodes[0], *nodes[21]).success);
+
+    // a query that reads the CSR arrays folds the appended links in
+    ASSERT_EQ(graph.getInDegree(*nodes[5]), 2);
+    ASSERT_EQ(graph.getNumberOfAppendedLinks(), 0);
+    ASSERT_EQ(graph.getNumberOfTombstones(), 0);
+
+    // past the compaction threshold the snapshot is dropped and rebuilt by the next traversal
+    CXXGRAPH::DirectedWeightedEdge<int> edge3(102, *nodes[1], *nodes[3], 1);
+    CXXGRAPH::DirectedWeightedEdge<int> edge4(103, *nodes[2], *nodes[4], 1);
+    graph.setCompactionThreshold(0.1);
+    graph.addEdge(&edge1);
+    graph.addEdge(&edge3);
+    ASSERT_EQ(graph.getNumberOfAppendedLinks(), 2);
+    graph.addEdge(&edge4);
+    ASSERT_EQ(graph.getNumberOfAppendedLinks(), 0);
+    ASSERT_EQ(graph.dijkstra(*nodes[0], *nodes[4]).result, 3);
+}
+
+TEST(GraphTest, Policy_1)
+{
+    CXXGRAPH::Node<int> node1(1, 1);
+    CXXGRAPH::Node<int> node2(2, 2);
+    CXXGRAPH::Node<int> node3(3, 3);
+    CXXGRAPH::DirectedWeightedEdge<int> edge1(1, node1, node2, 1.5);
+    CXXGRAPH::DirectedWeightedEdge<int> edge2(2, node2, node3, 2);
+    CXXGRAPH::UndirectedWeightedEdge<int> edge3(3, node1, node3, 6);
+    CXXGRAPH::DirectedEdge<int> edge4(4, node1, node3);
+    CXXGRAPH::DirectedWeightedGraph<int, float> graph;
+    graph.addEdge(&edge1);
+    graph.addEdge(&edge2);
+    // the Edges that do not match the policy are discarded
+    graph.addEdge(&edge3);
+    graph.addEdge(&edge4);
+    ASSERT_EQ(graph.getEdgeSet().size(), 2);
+    ASSERT_TRUE(graph.isDirectedGraph());
+    ASSERT_EQ(graph.getAdjMatrix().size(), 2);
+    auto res = graph.dijkstra(node1, node3);
+    ASSERT_TRUE(res.success);
+    ASSERT_EQ(res.result, 3.5);
+    ASSERT_EQ(sizeof(decltype(graph.freeze())::element_type::Record), 16);
+    ASSERT_EQ(graph.freeze()->getRecords()[0].weight, 1.5f);
+    CXXGRAPH::UndirectedWeightedGraph<int, int> undirectedGraph;
+    undirectedGraph.addEdge(&edge1);
+    undirectedGraph.addEdge(&edge3);
+    ASSERT_EQ(undirectedGraph.getEdgeSet().size(), 1);
+    ASSERT_FALSE(undirectedGraph.isDirectedGraph());
+    auto dialRes = undirectedGraph.dial(node1, 6);
+    ASSERT_EQ(dialRes.nodeIds, (std::vector<unsigned long>{1, 3}));
+    ASSERT_EQ(dialRes.distances, (std::vector<long>{0, 6}));
+    dialRes = undirectedGraph.dial(node3, 6);
+    ASSERT_EQ(dialRes.distances, (std::vector<long>{6, 0}));
+}
+
+TEST(GraphTest, MemoryUsage_1)
+{
+    CXXGRAPH::Node<int> node1(1, 1);
+    CXXGRAPH::Node<int> node2(2, 2);
+    CXXGRAPH::Node<int> node3(3, 3);
+    CXXGRAPH::DirectedWeightedEdge<int> edge1(1, node1, node2, 1);
+    CXXGRAPH::UndirectedEdge<int> edge2(2, node2, node3);
+    CXXGRAPH::Graph<int> graph;
+    auto empty = graph.memoryUsage();
+    ASSERT_EQ(empty.total, sizeof(CXXGRAPH::Graph<int>) + empty.indexes);
+    graph.addEdge(&edge1);
+    graph.addEdge(&edge2);
+    auto usage = graph.memoryUsage();
+    ASSERT_EQ(usage.edges, sizeof(CXXGRAPH::DirectedWeightedEdge<int>) + sizeof(CXXGRAPH::UndirectedEdge<int>));
+    ASSERT_EQ(usage.nodes, 3 * sizeof(CXXGRAPH::Node<int>));
+    ASSERT_GT(usage.edgeSet, 0);
+    ASSERT_GT(usage.nodeSet, 0);
+    ASSERT_GT(usage.indexes, 0);
+    ASSERT_GT(usage.adjacencyMatrix, 0);
+    ASSERT_EQ(usage.snapshots, 0);
+    graph.freeze();
+    auto frozen = graph.memoryUsage();
+    ASSERT_GT(frozen.snapshots, 0);
+    ASSERT_EQ(frozen.total, usage.total + frozen.snapshots);
+    auto partitionMap = graph.partitionGraph(CXXGRAPH::PARTITIONING::PartitionAlgorithm::GREEDY_VC_ALG, 2);
+    auto partitionUsage = CXXGRAPH::PARTITIONING::getPartitionMapMemoryUsage(partitionMap);
+    // the Edge and Node objects belong to the original graph
+    ASSERT_EQ(partitionUsage.edges, 0);
+    ASSERT_EQ(partitionUsage.nodes, 0);
+    ASSERT_GT(partitionUsage.edgeSet, 0);
+    ASSERT_GE(partitionUsage.graph, 2 * sizeof(CXXGRAPH::PARTITIONING::Partition<int>));
+    for (auto partition : partitionMap)
+    {
+        delete partition.second;
+    }
+}
+
 TEST(GraphTest, adj_print_1)
 {
     CXXGRAPH::Node<int> node1(1, 1);
@@ -0,0 +1,59 @@
+#include <random>
+#include <algorithm>
+#include "gtest/gtest.h"
+#include "CXXGraph.hpp"
+
+TEST(IndexedHeapTest, test_1)
+{
+    CXXGRAPH::IndexedHeap<double> heap(5);
+    ASSERT_TRUE(heap.empty());
+    ASSERT_TRUE(heap.pushOrDecrease(3, 7.0));
+    ASSERT_TRUE(heap.pushOrDecrease(1, 4.0));
+    ASSERT_TRUE(heap.pushOrDecrease(4, 9.0));
+    // a bigger key does not change the entry, a smaller one decrease it in place
+    ASSERT_FALSE(heap.pushOrDecrease(1, 5.0));
+    ASSERT_TRUE(heap.pushOrDecrease(4, 1.0));
+    ASSERT_EQ(heap.size(), 3);
+    ASSERT_TRUE(heap.contains(3));
+    ASSERT_FALSE(heap.contains(0));
+    ASSERT_EQ(heap.top().second, 4);
+    ASSERT_EQ(heap.pop(), std::make_pair(1.0, CXXGRAPH::DenseIndex(4)));
+    ASSERT_EQ(heap.pop(), std::make_pair(4.0, CXXGRAPH::DenseIndex(1)));
+    ASSERT_FALSE(heap.contains(1));
+    ASSERT_EQ(heap.pop(), std::make_pair(7.0, CXXGRAPH::DenseIndex(3)));
+    ASSERT_TRUE(heap.empty());
+    heap.reset(2);
+    ASSERT_TRUE(heap.pushOrDecrease(1, 2.0));
+    ASSERT_EQ(heap.pop().second, 1);
+}
+
+TEST(IndexedHeapTest, test_2)
+{
+    // random sequence of insertions, decreases and removals against a sorted reference
+    std::mt19937 generator(7);
+    std::uniform_int_distribution<CXXGRAPH::DenseIndex> indexDistribution(0, 999);
+    std::uniform_int_distribution<int> keyDistribution(0, 100000);
+    CXXGRAPH::IndexedHeap<int> heap(1000);
+    std::vector<int> keys(1000, -1);
+    for (int step = 0; step < 20000; ++step)
+    {
+        if (step % 3 == 2 && !heap.empty())
+        {
+            auto minimum = std::min_element(keys.begin(), keys.end(), [](int a, int b)
+                                            { return b < 0 || (a >= 0 && a < b); });
+            auto entry = heap.pop();
+            ASSERT_EQ(entry.first, *minimum);
+            ASSERT_EQ(keys[entry.second], entry.first);
+            keys[entry.second] = -1;
+            continue;
+        }
+        auto index = indexDistribution(generator);
+        int key = keyDistribution(generator);
+        bool expected = keys[index] < 0 || key < keys[index];
+        ASSERT_EQ(heap.pushOrDecrease(index, key), expected);
+        if (expected)
+        {
+            keys[index] = key;
+        }
+    }
+}
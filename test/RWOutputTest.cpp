@@ -932,4 +932,24 @@ TEST(RWOutputTest, test_27)
     fileCompressed.seekg(0, std::ios::end);
     int file_compressed_size = fileCompressed.tellg();
     ASSERT_LE(file_compressed_size, file_size);
-}
\ No newline at end of file
+}
+TEST(RWOutputTest, test_28)
+{
+    CXXGRAPH::Node<int> node1(1, 1);
+    CXXGRAPH::Node<int> node2(2, 2);
+    CXXGRAPH::Node<int> node3(3, 3);
+    CXXGRAPH::DirectedWeightedEdge<int> edge1(1, node1, node2, 5);
+    CXXGRAPH::UndirectedWeightedEdge<int> edge2(2, node2, node3, 6);
+    std::list<const CXXGRAPH::Edge<int> *> edgeSet;
+    edgeSet.push_back(&edge1);
+    edgeSet.push_back(&edge2);
+    CXXGRAPH::Graph_TS<int> graph(edgeSet);
+    int res = graph.writeToFile(CXXGRAPH::InputOutputFormat::STANDARD_CSV, ".", "test_28", false, true, true);
+    ASSERT_EQ(res, 0);
+    // the edges read from file are published as one batch under the lock
+    CXXGRAPH::Graph_TS<int> readGraph;
+    res = readGraph.readFromFile(CXXGRAPH::InputOutputFormat::STANDARD_CSV, ".", "test_28", false, true, true);
+    ASSERT_EQ(res, 0);
+    ASSERT_EQ(readGraph.getEdgeSet().size(), 2);
+    ASSERT_EQ(readGraph.getNodeSet().size(), 3);
+}
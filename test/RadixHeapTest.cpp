@@ -0,0 +1,55 @@
+#include <random>
+#include <set>
+#include "gtest/gtest.h"
+#include "CXXGraph.hpp"
+
+TEST(RadixHeapTest, test_1)
+{
+    CXXGRAPH::RadixHeap<unsigned long> heap;
+    ASSERT_TRUE(heap.empty());
+    heap.push(7, 3);
+    heap.push(4, 1);
+    heap.push(9, 4);
+    heap.push(4, 2);
+    ASSERT_EQ(heap.size(), 4);
+    ASSERT_EQ(heap.pop().first, 4);
+    ASSERT_EQ(heap.pop().first, 4);
+    // a key equal to the last popped one is still accepted
+    heap.push(4, 0);
+    ASSERT_EQ(heap.pop(), std::make_pair(4ul, CXXGRAPH::DenseIndex(0)));
+    ASSERT_EQ(heap.pop(), std::make_pair(7ul, CXXGRAPH::DenseIndex(3)));
+    heap.push(std::numeric_limits<unsigned long>::max(), 5);
+    ASSERT_EQ(heap.pop(), std::make_pair(9ul, CXXGRAPH::DenseIndex(4)));
+    ASSERT_EQ(heap.pop().second, 5);
+    ASSERT_TRUE(heap.empty());
+    heap.clear();
+    heap.push(0, 1);
+    ASSERT_EQ(heap.pop().second, 1);
+}
+
+TEST(RadixHeapTest, test_2)
+{
+    // random monotone sequence of insertions and removals against a sorted reference
+    std::mt19937 generator(9);
+    std::uniform_int_distribution<unsigned int> keyDistribution(0, 5000);
+    CXXGRAPH::RadixHeap<unsigned int> heap;
+    std::multiset<unsigned int> reference;
+    unsigned int last = 0;
+    for (int step = 0; step < 20000; ++step)
+    {
+        if (step % 3 == 2 && !reference.empty())
+        {
+            auto entry = heap.pop();
+            ASSERT_EQ(entry.first, *reference.begin());
+            reference.erase(reference.begin());
+            last = entry.first;
+        }
+        else
+        {
+            unsigned int key = last + keyDistribution(generator);
+            heap.push(key, step);
+            reference.insert(key);
+        }
+        ASSERT_EQ(heap.size(), reference.size());
+    }
+}